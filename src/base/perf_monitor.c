@@ -302,6 +302,8 @@ PSTAT_METADATA pstat_Metadata[] = {
 
   /* Execution statistics for network communication */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_NET_NUM_REQUESTS, "Num_network_requests"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_NET_LIST_PAGE_BYTES, "Num_network_list_page_bytes"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_NET_LIST_PAGE_SENT_BYTES, "Num_network_list_page_sent_bytes"),
 
   /* flush control stat */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FC_NUM_PAGES, "Num_adaptive_flush_pages"),
@@ -331,6 +333,9 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_TO_VACUUM_LOG_PAGES, "Num_vacuum_log_pages_to_vacuum"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_PREFETCH_REQUESTS_LOG_PAGES, "Num_vacuum_prefetch_requests_log_pages"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_PREFETCH_HITS_LOG_PAGES, "Num_vacuum_prefetch_hits_log_pages"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_VAC_NUM_BACKLOG_BLOCKS, "Num_vacuum_backlog_blocks"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_VAC_NUM_BACKLOG_LOG_PAGES, "Num_vacuum_backlog_log_pages"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_VAC_NUM_WORKER_LIMIT, "Num_vacuum_worker_limit"),
 
   /* Track heap modify counters. */
   /* Make a complex entry for heap stats */
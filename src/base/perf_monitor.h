@@ -377,6 +377,8 @@ typedef enum
 
   /* Execution statistics for network communication */
   PSTAT_NET_NUM_REQUESTS,
+  PSTAT_NET_LIST_PAGE_BYTES,
+  PSTAT_NET_LIST_PAGE_SENT_BYTES,
 
   /* flush control stat */
   PSTAT_FC_NUM_PAGES,
@@ -405,6 +407,9 @@ typedef enum
   PSTAT_VAC_NUM_TO_VACUUM_LOG_PAGES,
   PSTAT_VAC_NUM_PREFETCH_REQUESTS_LOG_PAGES,
   PSTAT_VAC_NUM_PREFETCH_HITS_LOG_PAGES,
+  PSTAT_VAC_NUM_BACKLOG_BLOCKS,
+  PSTAT_VAC_NUM_BACKLOG_LOG_PAGES,
+  PSTAT_VAC_NUM_WORKER_LIMIT,
 
   /* Track heap modify counters. */
   PSTAT_HEAP_HOME_INSERTS,
@@ -753,6 +753,26 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 
 #define PRM_NAME_ENABLE_MEMORY_MONITORING "enable_memory_monitoring"
 
+#define PRM_NAME_USE_PIPELINED_SUBQUERY_SCAN "use_pipelined_subquery_scan"
+
+#define PRM_NAME_BT_INDEX_SCAN_HEAP_PREFETCH "index_scan_heap_prefetch"
+
+#define PRM_NAME_PARTITION_SCAN_PREFETCH_THREADS "partition_scan_prefetch_threads"
+
+#define PRM_NAME_PARALLEL_AGGREGATION_THREADS "parallel_aggregation_threads"
+
+#define PRM_NAME_RECOVERY_UNDO_PARALLEL_COUNT "recovery_undo_parallel_count"
+
+#define PRM_NAME_RECOVERY_DEFER_PAGE_FLUSH "recovery_defer_page_flush"
+
+#define PRM_NAME_RECOVERY_REDO_PREFETCH_DISTANCE "recovery_redo_prefetch_distance"
+
+#define PRM_NAME_VACUUM_ADAPTIVE_WORKER_CONTROL "vacuum_adaptive_worker_control"
+
+#define PRM_NAME_VACUUM_MAX_LOG_BLOCKS_PER_SECOND "vacuum_max_log_blocks_per_second"
+
+#define PRM_NAME_NETWORK_RESULT_COMPRESSION "network_result_compression"
+
 /*
  * Note about ERROR_LIST and INTEGER_LIST type
  * ERROR_LIST type is an array of bool type with the size of -(ER_LAST_ERROR)
@@ -2457,6 +2477,56 @@ static UINT64 prm_max_subquery_cache_size_lower = 0;	/* 0 */
 static UINT64 prm_max_subquery_cache_size_upper = 16 * 1024 * 1024;	/* 16 MB */
 static unsigned int prm_max_subquery_cache_size_flag = 0;
 
+bool PRM_USE_PIPELINED_SUBQUERY_SCAN = false;
+static bool prm_use_pipelined_subquery_scan_default = false;
+static unsigned int prm_use_pipelined_subquery_scan_flag = 0;
+
+bool PRM_BT_INDEX_SCAN_HEAP_PREFETCH = false;
+static bool prm_bt_index_scan_heap_prefetch_default = false;
+static unsigned int prm_bt_index_scan_heap_prefetch_flag = 0;
+
+int PRM_PARTITION_SCAN_PREFETCH_THREADS = 0;
+static int prm_partition_scan_prefetch_threads_default = 0;
+static int prm_partition_scan_prefetch_threads_upper = 32;
+static int prm_partition_scan_prefetch_threads_lower = 0;
+static unsigned int prm_partition_scan_prefetch_threads_flag = 0;
+
+int PRM_PARALLEL_AGGREGATION_THREADS = 0;
+static int prm_parallel_aggregation_threads_default = 0;
+static int prm_parallel_aggregation_threads_upper = 32;
+static int prm_parallel_aggregation_threads_lower = 0;
+static unsigned int prm_parallel_aggregation_threads_flag = 0;
+
+int PRM_RECOVERY_UNDO_PARALLEL_COUNT = 0;
+static int prm_recovery_undo_parallel_count_default = 0;
+static int prm_recovery_undo_parallel_count_upper = 64;
+static int prm_recovery_undo_parallel_count_lower = 0;
+static unsigned int prm_recovery_undo_parallel_count_flag = 0;
+
+bool PRM_RECOVERY_DEFER_PAGE_FLUSH = false;
+static bool prm_recovery_defer_page_flush_default = false;
+static unsigned int prm_recovery_defer_page_flush_flag = 0;
+
+int PRM_RECOVERY_REDO_PREFETCH_DISTANCE = 0;
+static int prm_recovery_redo_prefetch_distance_default = 0;
+static int prm_recovery_redo_prefetch_distance_upper = 65536;
+static int prm_recovery_redo_prefetch_distance_lower = 0;
+static unsigned int prm_recovery_redo_prefetch_distance_flag = 0;
+
+bool PRM_VACUUM_ADAPTIVE_WORKER_CONTROL = false;
+static bool prm_vacuum_adaptive_worker_control_default = false;
+static unsigned int prm_vacuum_adaptive_worker_control_flag = 0;
+
+int PRM_VACUUM_MAX_LOG_BLOCKS_PER_SECOND = 0;
+static int prm_vacuum_max_log_blocks_per_second_default = 0;
+static int prm_vacuum_max_log_blocks_per_second_upper = 1000000;
+static int prm_vacuum_max_log_blocks_per_second_lower = 0;
+static unsigned int prm_vacuum_max_log_blocks_per_second_flag = 0;
+
+bool PRM_NETWORK_RESULT_COMPRESSION = false;
+static bool prm_network_result_compression_default = false;
+static unsigned int prm_network_result_compression_flag = 0;
+
 typedef int (*DUP_PRM_FUNC) (void *, SYSPRM_DATATYPE, void *, SYSPRM_DATATYPE);
 
 static int prm_size_to_io_pages (void *out_val, SYSPRM_DATATYPE out_type, void *in_val, SYSPRM_DATATYPE in_type);
@@ -6448,6 +6518,121 @@ SYSPRM_PARAM prm_Def[] = {
    (void *) &prm_max_subquery_cache_size_lower,
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_USE_PIPELINED_SUBQUERY_SCAN,
+   PRM_NAME_USE_PIPELINED_SUBQUERY_SCAN,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_use_pipelined_subquery_scan_flag,
+   (void *) &prm_use_pipelined_subquery_scan_default,
+   (void *) &PRM_USE_PIPELINED_SUBQUERY_SCAN,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_BT_INDEX_SCAN_HEAP_PREFETCH,
+   PRM_NAME_BT_INDEX_SCAN_HEAP_PREFETCH,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_bt_index_scan_heap_prefetch_flag,
+   (void *) &prm_bt_index_scan_heap_prefetch_default,
+   (void *) &PRM_BT_INDEX_SCAN_HEAP_PREFETCH,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PARTITION_SCAN_PREFETCH_THREADS,
+   PRM_NAME_PARTITION_SCAN_PREFETCH_THREADS,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_partition_scan_prefetch_threads_flag,
+   (void *) &prm_partition_scan_prefetch_threads_default,
+   (void *) &PRM_PARTITION_SCAN_PREFETCH_THREADS,
+   (void *) &prm_partition_scan_prefetch_threads_upper,
+   (void *) &prm_partition_scan_prefetch_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PARALLEL_AGGREGATION_THREADS,
+   PRM_NAME_PARALLEL_AGGREGATION_THREADS,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_parallel_aggregation_threads_flag,
+   (void *) &prm_parallel_aggregation_threads_default,
+   (void *) &PRM_PARALLEL_AGGREGATION_THREADS,
+   (void *) &prm_parallel_aggregation_threads_upper,
+   (void *) &prm_parallel_aggregation_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_RECOVERY_UNDO_PARALLEL_COUNT,
+   PRM_NAME_RECOVERY_UNDO_PARALLEL_COUNT,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_recovery_undo_parallel_count_flag,
+   (void *) &prm_recovery_undo_parallel_count_default,
+   (void *) &PRM_RECOVERY_UNDO_PARALLEL_COUNT,
+   (void *) &prm_recovery_undo_parallel_count_upper,
+   (void *) &prm_recovery_undo_parallel_count_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_RECOVERY_DEFER_PAGE_FLUSH,
+   PRM_NAME_RECOVERY_DEFER_PAGE_FLUSH,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_recovery_defer_page_flush_flag,
+   (void *) &prm_recovery_defer_page_flush_default,
+   (void *) &PRM_RECOVERY_DEFER_PAGE_FLUSH,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_RECOVERY_REDO_PREFETCH_DISTANCE,
+   PRM_NAME_RECOVERY_REDO_PREFETCH_DISTANCE,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_recovery_redo_prefetch_distance_flag,
+   (void *) &prm_recovery_redo_prefetch_distance_default,
+   (void *) &PRM_RECOVERY_REDO_PREFETCH_DISTANCE,
+   (void *) &prm_recovery_redo_prefetch_distance_upper,
+   (void *) &prm_recovery_redo_prefetch_distance_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_VACUUM_ADAPTIVE_WORKER_CONTROL,
+   PRM_NAME_VACUUM_ADAPTIVE_WORKER_CONTROL,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_vacuum_adaptive_worker_control_flag,
+   (void *) &prm_vacuum_adaptive_worker_control_default,
+   (void *) &PRM_VACUUM_ADAPTIVE_WORKER_CONTROL,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_VACUUM_MAX_LOG_BLOCKS_PER_SECOND,
+   PRM_NAME_VACUUM_MAX_LOG_BLOCKS_PER_SECOND,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_vacuum_max_log_blocks_per_second_flag,
+   (void *) &prm_vacuum_max_log_blocks_per_second_default,
+   (void *) &PRM_VACUUM_MAX_LOG_BLOCKS_PER_SECOND,
+   (void *) &prm_vacuum_max_log_blocks_per_second_upper,
+   (void *) &prm_vacuum_max_log_blocks_per_second_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_NETWORK_RESULT_COMPRESSION,
+   PRM_NAME_NETWORK_RESULT_COMPRESSION,
+   ((PRM_FOR_CLIENT | PRM_USER_CHANGE)),
+   PRM_BOOLEAN,
+   &prm_network_result_compression_flag,
+   (void *) &prm_network_result_compression_default,
+   (void *) &PRM_NETWORK_RESULT_COMPRESSION,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL}
 };
 
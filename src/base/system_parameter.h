@@ -486,8 +486,18 @@ enum param_id
 
   PRM_ID_ENABLE_MEMORY_MONITORING,
   PRM_ID_MAX_SUBQUERY_CACHE_SIZE,
+  PRM_ID_USE_PIPELINED_SUBQUERY_SCAN,
+  PRM_ID_BT_INDEX_SCAN_HEAP_PREFETCH,
+  PRM_ID_PARTITION_SCAN_PREFETCH_THREADS,
+  PRM_ID_PARALLEL_AGGREGATION_THREADS,
+  PRM_ID_RECOVERY_UNDO_PARALLEL_COUNT,
+  PRM_ID_RECOVERY_DEFER_PAGE_FLUSH,
+  PRM_ID_RECOVERY_REDO_PREFETCH_DISTANCE,
+  PRM_ID_VACUUM_ADAPTIVE_WORKER_CONTROL,
+  PRM_ID_VACUUM_MAX_LOG_BLOCKS_PER_SECOND,
+  PRM_ID_NETWORK_RESULT_COMPRESSION,
   /* change PRM_LAST_ID when adding new system parameters */
-  PRM_LAST_ID = PRM_ID_MAX_SUBQUERY_CACHE_SIZE
+  PRM_LAST_ID = PRM_ID_NETWORK_RESULT_COMPRESSION
 };
 typedef enum param_id PARAM_ID;
 
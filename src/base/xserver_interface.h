@@ -216,7 +216,7 @@ extern int xdisk_get_purpose_and_space_info (THREAD_ENTRY * thread_p, VOLID voli
 					     DISK_VOLUME_SPACE_INFO * space_info);
 
 extern int xqfile_get_list_file_page (THREAD_ENTRY * thread_p, QUERY_ID query_id, VOLID volid, PAGEID pageid,
-				      char *page_bufp, int *page_sizep);
+				      char *page_bufp, int page_buf_size, int *page_sizep);
 
 /* new query interface */
 extern int xqmgr_prepare_query (THREAD_ENTRY * thrd, compile_context * ctx, xasl_stream * stream);
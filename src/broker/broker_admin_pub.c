@@ -1930,6 +1930,26 @@ admin_conf_change (int master_shm_id, const char *br_name, const char *conf_name
       br_info_p->sql_log_max_size = sql_log_max_size;
       shm_as_p->sql_log_max_size = sql_log_max_size;
     }
+  else if (strcasecmp (conf_name, "SQL_LOG_FLUSH_INTERVAL") == 0)
+    {
+      int sql_log_flush_interval;
+
+      sql_log_flush_interval = (int) (ut_time_string_to_sec (conf_value, "msec") * 1000.0);
+
+      if (sql_log_flush_interval < 0)
+	{
+	  sprintf (admin_err_msg, "invalid value : %s", conf_value);
+	  goto set_conf_error;
+	}
+      else if (sql_log_flush_interval > MAX_SQL_LOG_FLUSH_INTERVAL)
+	{
+	  sprintf (admin_err_msg, "value is out of range : %s", conf_value);
+	  goto set_conf_error;
+	}
+
+      br_info_p->sql_log_flush_interval = sql_log_flush_interval;
+      shm_as_p->sql_log_flush_interval = sql_log_flush_interval;
+    }
   else if (strcasecmp (conf_name, "LONG_QUERY_TIME") == 0)
     {
       float long_query_time;
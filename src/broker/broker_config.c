@@ -258,6 +258,7 @@ const char *broker_keywords[] = {
   "SLOW_LOG_DIR",
   "SQL_LOG",
   "SQL_LOG_MAX_SIZE",
+  "SQL_LOG_FLUSH_INTERVAL",
   "SERVICE",
   "SSL",
 #if defined (FOR_ODBC_GATEWAY)
@@ -812,6 +813,22 @@ broker_config_read_internal (const char *conf_file, T_BROKER_INFO * br_info, int
 	  goto conf_error;
 	}
 
+      INI_GETSTR_CHK (s, ini, sec_name, "SQL_LOG_FLUSH_INTERVAL", DEFAULT_SQL_LOG_FLUSH_INTERVAL, &lineno);
+      strncpy_bufsize (time_str, s);
+      tmp_float = (float) ut_time_string_to_sec (time_str, "msec");
+      if (tmp_float < 0)
+	{
+	  errcode = PARAM_BAD_VALUE;
+	  goto conf_error;
+	}
+      /* change float to msec */
+      br_info[num_brs].sql_log_flush_interval = (int) (tmp_float * 1000.0);
+      if (br_info[num_brs].sql_log_flush_interval > MAX_SQL_LOG_FLUSH_INTERVAL)
+	{
+	  errcode = PARAM_BAD_RANGE;
+	  goto conf_error;
+	}
+
       INI_GETSTR_CHK (s, ini, sec_name, "LONG_QUERY_TIME", DEFAULT_LONG_QUERY_TIME, &lineno);
       strncpy_bufsize (time_str, s);
       tmp_float = (float) ut_time_string_to_sec (time_str, "sec");
@@ -1617,6 +1634,7 @@ broker_config_dump (FILE * fp, const T_BROKER_INFO * br_info, int num_broker, in
 	  fprintf (fp, "SLOW_LOG\t\t=%s\n", tmp_str);
 	}
       fprintf (fp, "SQL_LOG_MAX_SIZE\t=%d\n", br_info[i].sql_log_max_size);
+      fprintf (fp, "SQL_LOG_FLUSH_INTERVAL\t=%d\n", br_info[i].sql_log_flush_interval);
       fprintf (fp, "LONG_QUERY_TIME\t\t=%.2f\n", (br_info[i].long_query_time / 1000.0));
       fprintf (fp, "LONG_TRANSACTION_TIME\t=%.2f\n", (br_info[i].long_transaction_time / 1000.0));
       tmp_str = get_conf_string (br_info[i].auto_add_appl_server, tbl_on_off);
@@ -81,10 +81,12 @@
 #define CONF_ERR_LOG_BOTH       (CONF_ERR_LOG_LOGFILE | CONF_ERR_LOG_BROWSER)
 
 #define DEFAULT_SQL_LOG_MAX_SIZE	"10M"
+#define DEFAULT_SQL_LOG_FLUSH_INTERVAL  "0"
 #define DEFAULT_LONG_QUERY_TIME         "1min"
 #define DEFAULT_LONG_TRANSACTION_TIME   "1min"
 #define DEFAULT_ACCESS_LOG_MAX_SIZE     "10M"
 #define MAX_SQL_LOG_MAX_SIZE            2097152	/* 2G */
+#define MAX_SQL_LOG_FLUSH_INTERVAL      60000	/* 1min */
 #define MAX_ACCESS_LOG_MAX_SIZE         2097152	/* 2G */
 #define DEFAULT_MAX_NUM_DELAYED_HOSTS_LOOKUP    -1
 
@@ -225,6 +227,7 @@ struct t_broker_info
   int err_code;
   int os_err_code;
   int sql_log_max_size;
+  int sql_log_flush_interval;	/* msec */
   int long_query_time;		/* msec */
   int long_transaction_time;	/* msec */
 #if defined (WINDOWS)
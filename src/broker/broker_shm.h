@@ -618,6 +618,7 @@ struct t_shm_appl_server
   int max_string_length;
   int job_queue_size;
   int sql_log_max_size;
+  int sql_log_flush_interval;	/* msec */
   int long_query_time;		/* msec */
   int long_transaction_time;	/* msec */
   int max_prepared_stmt_count;
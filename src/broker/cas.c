@@ -1947,6 +1947,7 @@ process_request (SOCKET sock_fd, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
     {
 
       unset_hang_check_time ();
+      cas_log_flush ();
       if (as_info->cur_keep_con == KEEP_CON_AUTO)
 	{
 	  err_code = net_read_int_keep_con_auto (sock_fd, &client_msg_header, req_info);
@@ -2435,6 +2436,8 @@ net_read_process (SOCKET proxy_sock_fd, MSG_HEADER * client_msg_header, T_REQ_IN
       remained_timeout = timeout;
     }
 
+  cas_log_flush ();
+
   do
     {
       if (as_info->cas_log_reset)
@@ -94,6 +94,7 @@
 #define FK_INFO_SORT_BY_PKTABLE_NAME	1
 #define FK_INFO_SORT_BY_FKTABLE_NAME	2
 #define DBLINK_HINT                     "DBLINK"
+#define LOB_READ_MAX_SIZE               (1024 * 1024)
 
 typedef enum
 {
@@ -11297,19 +11298,29 @@ ux_lob_read (DB_VALUE * lob_dbval, INT64 offset, int size, T_NET_BUF * net_buf)
 {
   DB_BIGINT size_read;
   int err_code;
-  char *data = NET_BUF_CURR_PTR (net_buf) + NET_SIZE_INT;
+  char *data;
   DB_ELO *elo_debug;
 
   elo_debug = db_get_elo (lob_dbval);
   cas_log_debug (ARG_FILE_LINE, "ux_lob_read: locator=%s, size=%lld, type=%u", elo_debug->locator,
 		 elo_debug->size, elo_debug->type);
 
+  if (size + NET_SIZE_INT > NET_BUF_FREE_SIZE (net_buf))
+    {
+      /* grow the buffer for the requested length, so that a large LOB takes fewer round trips */
+      if (net_buf_reserve (net_buf, MIN (size, LOB_READ_MAX_SIZE) + NET_SIZE_INT) < 0)
+	{
+	  return ERROR_INFO_SET (CAS_ER_NO_MORE_MEMORY, CAS_ERROR_INDICATOR);
+	}
+    }
+
   if (size + NET_SIZE_INT > NET_BUF_FREE_SIZE (net_buf))
     {
       size = NET_BUF_FREE_SIZE (net_buf) - NET_SIZE_INT;
       cas_log_debug (ARG_FILE_LINE, "ux_lob_read: length reduced to %d", size);
     }
 
+  data = NET_BUF_CURR_PTR (net_buf) + NET_SIZE_INT;
   err_code = db_elo_read (elo_debug, offset, data, size, &size_read);
   cas_log_debug (ARG_FILE_LINE, "ux_lob_read: result_code=%d size_read=%lld", err_code, size_read);
   if (err_code < 0)
@@ -84,6 +84,7 @@ static void cas_log_rename (int run_time, time_t cur_time, char *br_name, int as
 static void cas_log_write_internal (FILE * fp, struct timeval *log_time, unsigned int seq_num, bool do_flush,
 				    const char *fmt, va_list ap);
 static void cas_log_write2_internal (FILE * fp, bool do_flush, const char *fmt, va_list ap);
+static void cas_log_flush_by_interval (FILE * fp);
 
 static FILE *access_log_open (char *log_file_name);
 static bool cas_log_begin_hang_check_time (void);
@@ -98,6 +99,7 @@ static char cas_log_error_flag;
 static FILE *log_fp = NULL, *slow_log_fp = NULL;
 static char log_filepath[BROKER_PATH_MAX], slow_log_filepath[BROKER_PATH_MAX];
 static INT64 saved_log_fpos = 0;
+static struct timeval last_log_flush_time = { 0, 0 };
 static CAS_LOG_FD_STATUS cas_log_fd_status = CAS_LOG_FD_NONE;
 
 static size_t cas_fwrite (const void *ptr, size_t size, size_t nmemb, FILE * stream);
@@ -448,7 +450,47 @@ cas_log_write_internal (FILE * fp, struct timeval *log_time, unsigned int seq_nu
 
   if (do_flush == true)
     {
-      cas_fflush (fp);
+      cas_log_flush_by_interval (fp);
+    }
+}
+
+/*
+ * cas_log_flush_by_interval () - flush the log lines written so far, unless the last flush is more recent than
+ *				  SQL_LOG_FLUSH_INTERVAL. With the default interval 0, every line is flushed.
+ */
+static void
+cas_log_flush_by_interval (FILE * fp)
+{
+  struct timeval now;
+  INT64 elapsed_msec;
+
+  if (shm_appl->sql_log_flush_interval > 0)
+    {
+      gettimeofday (&now, NULL);
+      elapsed_msec = ((INT64) (now.tv_sec - last_log_flush_time.tv_sec) * 1000
+		      + (now.tv_usec - last_log_flush_time.tv_usec) / 1000);
+      if (elapsed_msec >= 0 && elapsed_msec < shm_appl->sql_log_flush_interval)
+	{
+	  /* the buffered lines are written by a later flush or when cas waits for the next request */
+	  return;
+	}
+      last_log_flush_time = now;
+    }
+
+  cas_fflush (fp);
+}
+
+/*
+ * cas_log_flush () - write out the buffered sql log lines. It is called before cas waits for the next request, so
+ *		      the lines held back by SQL_LOG_FLUSH_INTERVAL do not stay buffered while cas is idle.
+ */
+void
+cas_log_flush (void)
+{
+  if (log_fp != NULL)
+    {
+      cas_fflush (log_fp);
+      gettimeofday (&last_log_flush_time, NULL);
     }
 }
 
@@ -636,7 +678,7 @@ cas_log_write2_internal (FILE * fp, bool do_flush, const char *fmt, va_list ap)
 
   if (do_flush == true)
     {
-      cas_fflush (fp);
+      cas_log_flush_by_interval (fp);
     }
 }
 
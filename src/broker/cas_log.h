@@ -53,6 +53,7 @@ extern void cas_error_log (int err_code, char *err_msg, int client_ip_addr);
 extern int cas_access_log (struct timeval *start_time, int as_index, int client_ip_addr, char *dbname, char *dbuser,
 			   ACCESS_LOG_TYPE log_type);
 extern void cas_log_end (int mode, int run_time_sec, int run_time_msec);
+extern void cas_log_flush (void);
 extern void cas_log_write_nonl (unsigned int seq_num, bool unit_start, const char *fmt, ...);
 extern void cas_log_write (unsigned int seq_num, bool unit_start, const char *fmt, ...);
 extern void cas_log_write_and_end (unsigned int seq_num, bool unit_start, const char *fmt, ...);
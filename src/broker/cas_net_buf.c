@@ -95,6 +95,12 @@ net_buf_cp_post_send_file (T_NET_BUF * net_buf, int size, char *filename)
   return 0;
 }
 
+int
+net_buf_reserve (T_NET_BUF * net_buf, int size)
+{
+  return net_buf_realloc (net_buf, size);
+}
+
 int
 net_buf_cp_byte (T_NET_BUF * net_buf, char ch)
 {
@@ -109,6 +109,7 @@ extern void net_buf_init (T_NET_BUF * net_buf, T_BROKER_VERSION client_version);
 extern void net_buf_clear (T_NET_BUF * net_buf);
 extern void net_buf_destroy (T_NET_BUF * net_buf);
 extern int net_buf_cp_post_send_file (T_NET_BUF * net_buf, int, char *str);
+extern int net_buf_reserve (T_NET_BUF * net_buf, int size);
 extern int net_buf_cp_byte (T_NET_BUF * net_buf, char ch);
 extern int net_buf_cp_str (T_NET_BUF * net_buf, const char *buf, int size);
 extern int net_buf_cp_int (T_NET_BUF * net_buf, int value, int *begin_offset);
@@ -92,6 +92,7 @@ shard_shm_set_shm_as (T_SHM_APPL_SERVER * shm_as_p, T_BROKER_INFO * br_info_p)
   shm_as_p->num_appl_server = br_info_p->appl_server_num;
   shm_as_p->sql_log_mode = br_info_p->sql_log_mode;
   shm_as_p->sql_log_max_size = br_info_p->sql_log_max_size;
+  shm_as_p->sql_log_flush_interval = br_info_p->sql_log_flush_interval;
   shm_as_p->long_query_time = br_info_p->long_query_time;
   shm_as_p->long_transaction_time = br_info_p->long_transaction_time;
   shm_as_p->appl_server_max_size = br_info_p->appl_server_max_size;
@@ -296,6 +296,7 @@ enum net_server_request
 #define NET_CAP_INTERRUPT_ENABLED       0x00800000
 #define NET_CAP_UPDATE_DISABLED         0x00008000
 #define NET_CAP_REMOTE_DISABLED         0x00000080
+#define NET_CAP_LIST_PAGE_COMPRESSION   0x00000010
 #define NET_CAP_HA_REPL_DELAY           0x00000008
 #define NET_CAP_HA_REPLICA              0x00000004
 #define NET_CAP_HA_IGNORE_REPL_DELAY	0x00000002
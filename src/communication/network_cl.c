@@ -92,6 +92,9 @@ static char net_Server_host[CUB_MAXHOSTNAMELEN + 1] = "";
 /* Contains the name of the current server name. */
 static char net_Server_name[DB_MAX_IDENTIFIER_LENGTH + 1] = "";
 
+/* Capabilities the current server announced at the handshake. */
+static int net_Server_capabilities = 0;
+
 static void return_error_to_server (char *host, unsigned int eid);
 static int client_capabilities (void);
 static int check_server_capabilities (int server_cap, int client_type, int rel_compare,
@@ -166,6 +169,7 @@ set_server_error (int error)
     {
       net_Server_name[0] = '\0';
       net_Server_host[0] = '\0';
+      net_Server_capabilities = 0;
       boot_server_die_or_changed ();
     }
 
@@ -466,6 +470,19 @@ net_client_get_server_name (void)
   return net_Server_name;
 }
 
+/*
+ * net_client_is_server_capable () - whether the current server announced
+ *                                   the given capability at the handshake
+ *
+ * return: true or false
+ *   capability(in): NET_CAP_XXX bit
+ */
+bool
+net_client_is_server_capable (int capability)
+{
+  return (net_Server_capabilities & capability) != 0;
+}
+
 /*
  * net_client_request_internal -
  *
@@ -3590,6 +3607,8 @@ net_client_ping_server_with_handshake (int client_type, bool check_capabilities,
       return error;
     }
 
+  net_Server_capabilities = server_capabilities;
+
   return error;
 }
 
@@ -76,6 +76,7 @@
 #include "method_error.hpp"
 #include "message_catalog.h"
 #include "utility.h"
+#include "lz4.h"
 
 /*
  * Use db_clear_private_heap instead of db_destroy_private_heap
@@ -88,6 +89,10 @@
 #define NET_DEFER_END_QUERIES_MAX 5
 static QUERY_ID net_Deferred_end_queries[NET_DEFER_END_QUERIES_MAX];
 static int net_Deferred_end_queries_count = 0;
+
+/* receive area of the compressed list file pages; grown on demand and kept for the next fetches */
+static char *net_List_page_recv_buffer = NULL;
+static int net_List_page_recv_buffer_size = 0;
 #endif /* CS_MODE */
 
 /*
@@ -6881,9 +6886,11 @@ btree_class_test_unique (char *buf, int buf_size)
  *   volid(in):
  *   pageid(in):
  *   buffer(in):
- *   buffer_size(in):
+ *   buffer_size(in/out): size of buffer on input, size of the pages copied to buffer on output
  *
- * NOTE:
+ * NOTE: Following pages are also copied while they fit in the buffer.
+ *       If network_result_compression is on and the server supports it, the
+ *       pages may come LZ4 compressed and are decompressed into the buffer.
  */
 int
 qfile_get_list_file_page (QUERY_ID query_id, VOLID volid, PAGEID pageid, char *buffer, int *buffer_size)
@@ -6892,24 +6899,79 @@ qfile_get_list_file_page (QUERY_ID query_id, VOLID volid, PAGEID pageid, char *b
   int error = ER_NET_CLIENT_DATA_RECEIVE;
   int req_error;
   char *ptr;
-  OR_ALIGNED_BUF (OR_PTR_SIZE + OR_INT_SIZE + OR_INT_SIZE) a_request;
+  OR_ALIGNED_BUF (OR_PTR_SIZE + OR_INT_SIZE * 4) a_request;
   char *request;
-  OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
+  OR_ALIGNED_BUF (OR_INT_SIZE * 3) a_reply;
   char *reply;
+  char *recv_buffer;
+  int recv_size, buffer_capacity;
+  int page_size;
+  bool compress;
 
   request = OR_ALIGNED_BUF_START (a_request);
   reply = OR_ALIGNED_BUF_START (a_reply);
 
+  compress = (prm_get_bool_value (PRM_ID_NETWORK_RESULT_COMPRESSION)
+	      && net_client_is_server_capable (NET_CAP_LIST_PAGE_COMPRESSION));
+
+  buffer_capacity = *buffer_size;
+  recv_buffer = buffer;
+  if (compress)
+    {
+      if (net_List_page_recv_buffer_size < buffer_capacity)
+	{
+	  recv_buffer = (char *) realloc (net_List_page_recv_buffer, buffer_capacity);
+	  if (recv_buffer != NULL)
+	    {
+	      net_List_page_recv_buffer = recv_buffer;
+	      net_List_page_recv_buffer_size = buffer_capacity;
+	    }
+	}
+
+      if (net_List_page_recv_buffer_size >= buffer_capacity)
+	{
+	  recv_buffer = net_List_page_recv_buffer;
+	}
+      else
+	{
+	  /* take the pages uncompressed */
+	  recv_buffer = buffer;
+	  compress = false;
+	}
+    }
+
   ptr = or_pack_ptr (request, query_id);
   ptr = or_pack_int (ptr, (int) volid);
   ptr = or_pack_int (ptr, (int) pageid);
+  ptr = or_pack_int (ptr, buffer_capacity);
+  ptr = or_pack_int (ptr, compress ? 1 : 0);
 
   req_error =
     net_client_request2_no_malloc (NET_SERVER_LS_GET_LIST_FILE_PAGE, request, OR_ALIGNED_BUF_SIZE (a_request), reply,
-				   OR_ALIGNED_BUF_SIZE (a_reply), NULL, 0, buffer, buffer_size);
+				   compress ? OR_INT_SIZE * 3 : OR_INT_SIZE * 2, NULL, 0, recv_buffer, &recv_size);
   if (!req_error)
     {
       ptr = or_unpack_int (&reply[OR_INT_SIZE], &error);
+      *buffer_size = recv_size;
+
+      if (compress)
+	{
+	  ptr = or_unpack_int (ptr, &page_size);
+	  if (page_size == recv_size)
+	    {
+	      memcpy (buffer, recv_buffer, recv_size);
+	    }
+	  else if (page_size > buffer_capacity
+		   || LZ4_decompress_safe (recv_buffer, buffer, recv_size, page_size) != page_size)
+	    {
+	      error = ER_NET_SERVER_DATA_RECEIVE;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+	    }
+	  else
+	    {
+	      *buffer_size = page_size;
+	    }
+	}
     }
 
   return error;
@@ -6919,7 +6981,8 @@ qfile_get_list_file_page (QUERY_ID query_id, VOLID volid, PAGEID pageid, char *b
 
   THREAD_ENTRY *thread_p = enter_server ();
 
-  success = xqfile_get_list_file_page (thread_p, query_id, volid, pageid, buffer, &page_size);
+  success = xqfile_get_list_file_page (thread_p, query_id, volid, pageid, buffer, *buffer_size, &page_size);
+  *buffer_size = page_size;
 
   exit_server (*thread_p);
 
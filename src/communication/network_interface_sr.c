@@ -91,6 +91,7 @@
 #include "crypt_opfunc.h"
 #include "flashback.h"
 #include "method_compile.hpp"
+#include "lz4.h"
 // XXX: SHOULD BE THE LAST INCLUDE HEADER
 #include "memory_wrapper.hpp"
 
@@ -111,6 +112,9 @@
 // To have the safe area is just a safe guard to avoid potential issues of bad size calculation.
 #define QEWC_MAX_DATA_SIZE  (DB_PAGESIZE - QEWC_SAFE_GUARD_SIZE)
 
+/* List file pages smaller than this are not worth compressing. */
+#define NET_LIST_PAGE_COMPRESS_MIN_SIZE 1024
+
 /* This file is only included in the server.  So set the on_server flag on */
 unsigned int db_on_server = 1;
 
@@ -136,6 +140,8 @@ static int er_log_slow_query (THREAD_ENTRY * thread_p, EXECUTION_INFO * info, in
 static void event_log_slow_query (THREAD_ENTRY * thread_p, EXECUTION_INFO * info, int time, UINT64 * diff_stats);
 static void event_log_many_ioreads (THREAD_ENTRY * thread_p, EXECUTION_INFO * info, int time, UINT64 * diff_stats);
 static void event_log_temp_expand_pages (THREAD_ENTRY * thread_p, EXECUTION_INFO * info);
+static void sqfile_send_list_file_page (THREAD_ENTRY * thread_p, unsigned int rid, char *page_buf, int page_size,
+					int error, bool compress);
 
 /*
  * stran_server_commit_internal - commit transaction on server.
@@ -436,6 +442,7 @@ server_capabilities (void)
   int capabilities = 0;
 
   capabilities |= NET_CAP_INTERRUPT_ENABLED;
+  capabilities |= NET_CAP_LIST_PAGE_COMPRESSION;
   if (db_Disable_modifications > 0)
     {
       capabilities |= NET_CAP_UPDATE_DISABLED;
@@ -4793,6 +4800,70 @@ sdk_vlabel (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen
     }
 }
 
+/*
+ * sqfile_send_list_file_page - send list file pages to the client
+ *
+ * return:
+ *
+ *   rid(in):
+ *   page_buf(in): pages to send
+ *   page_size(in): size of the pages
+ *   error(in): error code to reply
+ *   compress(in): true if the client takes LZ4 compressed pages
+ *
+ * NOTE: If the client takes compressed pages, the reply has a third integer,
+ *       the size of the pages before compression. The pages are sent as is if
+ *       it equals the size of the data.
+ */
+static void
+sqfile_send_list_file_page (THREAD_ENTRY * thread_p, unsigned int rid, char *page_buf, int page_size, int error,
+			    bool compress)
+{
+  OR_ALIGNED_BUF (OR_INT_SIZE * 3) a_reply;
+  char *reply = OR_ALIGNED_BUF_START (a_reply);
+  char *ptr;
+  char *compress_buf = NULL;
+  char *send_buf = page_buf;
+  int send_size = page_size;
+  int compress_buf_size, compressed_size;
+
+  if (compress && page_size >= NET_LIST_PAGE_COMPRESS_MIN_SIZE)
+    {
+      compress_buf_size = LZ4_compressBound (page_size);
+      compress_buf = (char *) db_private_alloc (thread_p, compress_buf_size);
+      if (compress_buf != NULL)
+	{
+	  compressed_size = LZ4_compress_default (page_buf, compress_buf, page_size, compress_buf_size);
+	  if (compressed_size > 0 && compressed_size < page_size)
+	    {
+	      send_buf = compress_buf;
+	      send_size = compressed_size;
+	    }
+	}
+      else
+	{
+	  /* send the pages uncompressed */
+	  er_clear ();
+	}
+    }
+
+  perfmon_add_stat (thread_p, PSTAT_NET_LIST_PAGE_BYTES, page_size);
+  perfmon_add_stat (thread_p, PSTAT_NET_LIST_PAGE_SENT_BYTES, send_size);
+
+  ptr = or_pack_int (reply, send_size);
+  ptr = or_pack_int (ptr, error);
+  if (compress)
+    {
+      ptr = or_pack_int (ptr, page_size);
+    }
+  css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, (int) (ptr - reply), send_buf, send_size);
+
+  if (compress_buf != NULL)
+    {
+      db_private_free_and_init (thread_p, compress_buf);
+    }
+}
+
 /*
  * sqfile_get_list_file_page -
  *
@@ -4810,10 +4881,11 @@ sqfile_get_list_file_page (THREAD_ENTRY * thread_p, unsigned int rid, char *requ
   QUERY_ID query_id;
   int volid, pageid;
   char *ptr;
-  OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
-  char *reply = OR_ALIGNED_BUF_START (a_reply);
   char page_buf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT], *aligned_page_buf;
+  char *fetch_buf = NULL;
+  int page_buf_size = IO_MAX_PAGE_SIZE;
   int page_size;
+  int compress = 0;
   int error = NO_ERROR;
 
   aligned_page_buf = PTR_ALIGN (page_buf, MAX_ALIGNMENT);
@@ -4821,13 +4893,39 @@ sqfile_get_list_file_page (THREAD_ENTRY * thread_p, unsigned int rid, char *requ
   ptr = or_unpack_ptr (request, &query_id);
   ptr = or_unpack_int (ptr, &volid);
   ptr = or_unpack_int (ptr, &pageid);
+  if (ptr - request < reqlen)
+    {
+      /* the client tells how many following pages it can take */
+      ptr = or_unpack_int (ptr, &page_buf_size);
+      page_buf_size = MAX (page_buf_size, IO_MAX_PAGE_SIZE);
+      page_buf_size = MIN (page_buf_size, QFILE_MAX_LIST_FILE_PAGE_FETCH_SIZE);
+    }
+  if (ptr - request < reqlen)
+    {
+      /* the client takes compressed pages */
+      ptr = or_unpack_int (ptr, &compress);
+    }
 
   if (volid == NULL_VOLID && pageid == NULL_PAGEID)
     {
       goto empty_page;
     }
 
-  error = xqfile_get_list_file_page (thread_p, query_id, volid, pageid, aligned_page_buf, &page_size);
+  if (page_buf_size > IO_MAX_PAGE_SIZE)
+    {
+      fetch_buf = (char *) db_private_alloc (thread_p, page_buf_size + MAX_ALIGNMENT);
+      if (fetch_buf != NULL)
+	{
+	  aligned_page_buf = PTR_ALIGN (fetch_buf, MAX_ALIGNMENT);
+	}
+      else
+	{
+	  er_clear ();
+	  page_buf_size = IO_MAX_PAGE_SIZE;
+	}
+    }
+
+  error = xqfile_get_list_file_page (thread_p, query_id, volid, pageid, aligned_page_buf, page_buf_size, &page_size);
   if (error != NO_ERROR)
     {
       (void) return_error_to_client (thread_p, rid);
@@ -4839,20 +4937,23 @@ sqfile_get_list_file_page (THREAD_ENTRY * thread_p, unsigned int rid, char *requ
       goto empty_page;
     }
 
-  ptr = or_pack_int (reply, page_size);
-  ptr = or_pack_int (ptr, error);
-  css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply), aligned_page_buf,
-				     page_size);
+  sqfile_send_list_file_page (thread_p, rid, aligned_page_buf, page_size, error, compress != 0);
+  if (fetch_buf != NULL)
+    {
+      db_private_free_and_init (thread_p, fetch_buf);
+    }
   return;
 
 empty_page:
   /* setup empty list file page and return it */
+  if (fetch_buf != NULL)
+    {
+      db_private_free_and_init (thread_p, fetch_buf);
+    }
+  aligned_page_buf = PTR_ALIGN (page_buf, MAX_ALIGNMENT);
   qmgr_setup_empty_list_file (aligned_page_buf);
   page_size = QFILE_PAGE_HEADER_SIZE;
-  ptr = or_pack_int (reply, page_size);
-  ptr = or_pack_int (ptr, error);
-  css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply), aligned_page_buf,
-				     page_size);
+  sqfile_send_list_file_page (thread_p, rid, aligned_page_buf, page_size, error, compress != 0);
 }
 
 /*
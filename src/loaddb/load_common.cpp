@@ -27,6 +27,7 @@
 #include "intl_support.h"
 
 #include <fstream>
+#include <vector>
 // XXX: SHOULD BE THE LAST INCLUDE HEADER
 #include "memory_wrapper.hpp"
 
@@ -634,7 +635,7 @@ namespace cubload
   static int
   append_incomplete_row (std::string &batch_buffer, std::string &one_row_buffer, batch_handler &b_handler,
 			 class_id &clsid, batch_id &batch_id, int lineno,
-			 int &one_row_lineno, int &batch_start_offset, int64_t &batch_rows)
+			 int &one_row_lineno, int &batch_start_offset, int64_t &batch_rows, size_t buffer_size_limit)
   {
     int error_code = NO_ERROR;
 
@@ -642,7 +643,7 @@ namespace cubload
 
     // The content contained in one_row_buffer may not be a complete row.
     // TODO: How about handling errors right away without having to send them to the server?
-    if ((one_row_buffer.size() + batch_buffer.size()) >= LOADDB_BUFFER_SIZE_LIMIT)
+    if ((one_row_buffer.size() + batch_buffer.size()) >= buffer_size_limit)
       {
 	error_code = handle_batch (b_handler, clsid, batch_buffer, batch_id, batch_start_offset, batch_rows);
 	if (error_code != NO_ERROR)
@@ -662,6 +663,13 @@ namespace cubload
 
   int
   split (int batch_size, const std::string &object_file_name, class_handler &c_handler, batch_handler &b_handler)
+  {
+    return split (batch_size, object_file_name, c_handler, b_handler, LOADDB_BUFFER_SIZE_LIMIT);
+  }
+
+  int
+  split (int batch_size, const std::string &object_file_name, class_handler &c_handler, batch_handler &b_handler,
+	 size_t buffer_size_limit)
   {
     int error_code;
     int64_t batch_rows = 0;
@@ -677,6 +685,7 @@ namespace cubload
     bool  size_over = false;
 #define DEFAULT_STRING_SZ (4096)
 #define DEFAULT_ONEROW_BUF_SZ (1024*1024*1) // 1MB
+#define DEFAULT_READ_BUF_SZ (1024*1024*1) // 1MB
     size_t size_bk = DEFAULT_STRING_SZ;
 
     if (object_file_name.empty ())
@@ -684,7 +693,11 @@ namespace cubload
 	return ER_FILE_UNKNOWN_FILE;
       }
 
-    std::ifstream object_file (object_file_name, std::fstream::in | std::fstream::binary);
+    // read the object file in large chunks; the buffer must be set before the file is opened
+    std::vector<char> read_buffer (DEFAULT_READ_BUF_SZ);
+    std::ifstream object_file;
+    object_file.rdbuf ()->pubsetbuf (read_buffer.data (), read_buffer.size ());
+    object_file.open (object_file_name, std::fstream::in | std::fstream::binary);
     if (!object_file)
       {
 	// file does not exists
@@ -709,7 +722,7 @@ namespace cubload
 	    if (one_row_buffer.empty() == false)
 	      {
 		error_code = append_incomplete_row (batch_buffer, one_row_buffer, b_handler, clsid, batch_id,
-						    lineno, one_row_lineno, batch_start_offset, batch_rows);
+						    lineno, one_row_lineno, batch_start_offset, batch_rows, buffer_size_limit);
 		if (error_code != NO_ERROR)
 		  {
 		    object_file.close ();
@@ -765,12 +778,6 @@ namespace cubload
 	    continue;
 	  }
 
-	// it is a line containing row data so append it
-	one_row_buffer.append (line);
-
-	// since std::getline eats end line character, add it back in order to make loaddb lexer happy
-	one_row_buffer.append ("\n");
-
 	// check for matching single quotes
 	for (const char &c: line)
 	  {
@@ -781,31 +788,48 @@ namespace cubload
 	  }
 
 	// it could be that a row is wrapped on the next line,
-	// this means that the row ends on the last line that does not end with '+' (plus) character
-	if (ends_with (line, "+"))
-	  {
-	    continue;
-	  }
-
+	// this means that the row ends on the last line that does not end with '+' (plus) character.
 	// if single_quote_checker is 1, it means that a single quote was opened but not closed
-	if (single_quote_checker == 1)
-	  {
-	    continue;
-	  }
+	bool row_continues = ends_with (line, "+") || single_quote_checker == 1;
 
-	if ((one_row_buffer.size() + batch_buffer.size()) >= LOADDB_BUFFER_SIZE_LIMIT)
-	  {
-	    size_over = true;
-	  }
-	else
+	if (one_row_buffer.empty () && !row_continues
+	    && (line.size () + 1 + batch_buffer.size ()) < buffer_size_limit)
 	  {
-	    batch_buffer.append (one_row_buffer);
-	    one_row_buffer.clear();
+	    // a row on a single line, which is the common case; append it to the batch without staging it
+	    batch_buffer.append (line);
+	    batch_buffer.append ("\n");
 	    one_row_lineno = 0;
 
 	    ++batch_rows;
 	    size_over = false;
 	  }
+	else
+	  {
+	    // it is a line containing row data so append it
+	    one_row_buffer.append (line);
+
+	    // since std::getline eats end line character, add it back in order to make loaddb lexer happy
+	    one_row_buffer.append ("\n");
+
+	    if (row_continues)
+	      {
+		continue;
+	      }
+
+	    if ((one_row_buffer.size() + batch_buffer.size()) >= buffer_size_limit)
+	      {
+		size_over = true;
+	      }
+	    else
+	      {
+		batch_buffer.append (one_row_buffer);
+		one_row_buffer.clear();
+		one_row_lineno = 0;
+
+		++batch_rows;
+		size_over = false;
+	      }
+	  }
 
 	// check if we have a full batch
 	if (batch_rows == batch_size || size_over)
@@ -841,7 +865,7 @@ namespace cubload
     if (one_row_buffer.empty() == false)
       {
 	error_code = append_incomplete_row (batch_buffer, one_row_buffer, b_handler, clsid, batch_id,
-					    lineno, one_row_lineno, batch_start_offset, batch_rows);
+					    lineno, one_row_lineno, batch_start_offset, batch_rows, buffer_size_limit);
 	if (error_code != NO_ERROR)
 	  {
 	    object_file.close ();
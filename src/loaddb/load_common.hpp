@@ -425,6 +425,14 @@ namespace cubload
    */
   int split (int batch_size, const std::string &object_file_name, class_handler &c_handler, batch_handler &b_handler);
 
+  /*
+   * Same as above, with the size limit of a batch given instead of the default one (2GB - 1K), e.g. for testing.
+   *
+   *    buffer_size_limit(in): a batch is sent before it would grow past this size in bytes
+   */
+  int split (int batch_size, const std::string &object_file_name, class_handler &c_handler, batch_handler &b_handler,
+	     size_t buffer_size_limit);
+
 } // namespace cubload
 
 // alias declaration for legacy C files
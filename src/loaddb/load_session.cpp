@@ -28,13 +28,31 @@
 #include "resource_shared_pool.hpp"
 #include "xserver_interface.h"
 
-#include <sstream>
+#include <istream>
+#include <streambuf>
 // XXX: SHOULD BE THE LAST INCLUDE HEADER
 #include "memory_wrapper.hpp"
 
 namespace cubload
 {
 
+  /*
+   * cubload::batch_streambuf
+   *    extends std::streambuf
+   *
+   * description
+   *    Read-only stream buffer over the content of a batch. Unlike std::istringstream, it does not copy the content
+   */
+  class batch_streambuf : public std::streambuf
+  {
+    public:
+      explicit batch_streambuf (const std::string &content)
+      {
+	char *begin = const_cast<char *> (content.data ());
+	setg (begin, begin, begin + content.size ());
+      }
+  };
+
   void init_driver (driver *driver, session &session);
 
   bool invoke_parser (driver *driver, const batch &batch_);
@@ -79,7 +97,8 @@ namespace cubload
     driver->get_class_installer ().set_class_id (batch_.get_class_id ());
 
     // parse doc says that 0 is returned if parsing succeeds
-    std::istringstream iss (batch_.get_content ());
+    batch_streambuf batch_buf (batch_.get_content ());
+    std::istream iss (&batch_buf);
     int parser_result = driver->parse (iss, batch_.get_line_offset ());
 
     driver->get_object_loader ().destroy ();
@@ -45,7 +45,9 @@
 #include "dbtype.h"
 
 #define CURSOR_BUFFER_SIZE              DB_PAGESIZE
-#define CURSOR_BUFFER_AREA_SIZE         IO_MAX_PAGE_SIZE
+/* the server fills the buffer area with as many following list file pages as fit, saving round trips when the
+ * result is fetched sequentially */
+#define CURSOR_BUFFER_AREA_SIZE         (4 * IO_MAX_PAGE_SIZE)
 
 enum
 {
@@ -573,13 +575,15 @@ cursor_get_list_file_page (CURSOR_ID * cursor_id_p, VPID * vpid_p)
   if (cursor_id_p->buffer == NULL)
     {
       int ret_val;
+      int filled_size = CURSOR_BUFFER_AREA_SIZE;
 
       ret_val = qfile_get_list_file_page (cursor_id_p->query_id, vpid_p->volid, vpid_p->pageid,
-					  cursor_id_p->buffer_area, &cursor_id_p->buffer_filled_size);
+					  cursor_id_p->buffer_area, &filled_size);
       if (ret_val != NO_ERROR)
 	{
 	  return ret_val;
 	}
+      cursor_id_p->buffer_filled_size = filled_size;
 
       cursor_id_p->buffer = cursor_id_p->buffer_area;
       QFILE_COPY_VPID (&cursor_id_p->header_vpid, vpid_p);
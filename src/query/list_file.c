@@ -2245,17 +2245,19 @@ qfile_destroy_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_id_p)
  *   volid(in): List file page volume identifier
  *   pageid(in): List file page identifier
  *   page_bufp(out): Buffer to contain list file page content
+ *   page_buf_size(in): Size of the buffer
  *   page_sizep(out):
  *
  * Note: This routine is basically called by the C/S communication
  *              routines to fetch and copy the indicated list file page to
  *              the buffer area. The area pointed by the buffer must have
  *              been allocated by the caller and should be big enough to
- *              store a list file page.
+ *              store a list file page. The pages following the indicated
+ *              one are appended while they fit in the buffer.
  */
 int
 xqfile_get_list_file_page (THREAD_ENTRY * thread_p, QUERY_ID query_id, VOLID vol_id, PAGEID page_id, char *page_buf_p,
-			   int *page_size_p)
+			   int page_buf_size, int *page_size_p)
 {
   QMGR_QUERY_ENTRY *query_entry_p = NULL;
   QFILE_LIST_ID *list_id_p;
@@ -2315,8 +2317,10 @@ xqfile_get_list_file_page (THREAD_ENTRY * thread_p, QUERY_ID query_id, VOLID vol
     }
 
 get_page:
-  /* append pages until a network page is full */
-  while ((*page_size_p + DB_PAGESIZE) <= IO_MAX_PAGE_SIZE)
+  assert (page_buf_size >= DB_PAGESIZE);
+
+  /* append pages until the buffer is full */
+  while ((*page_size_p + DB_PAGESIZE) <= page_buf_size)
     {
       page_p = qmgr_get_old_page (thread_p, &vpid, tfile_vfid_p);
       if (page_p == NULL)
@@ -951,6 +951,111 @@ qdata_evaluate_aggregate_list (cubthread::entry *thread_p, cubxasl::aggregate_li
   return NO_ERROR;
 }
 
+/*
+ * qdata_is_partial_aggregate_supported () - can the aggregate be computed as partial states that are combined later?
+ *   return: true if the aggregate can be split
+ *   agg_p(in): aggregate node
+ *
+ * Note: Partial states are kept in accumulators that do not belong to the aggregate node and are filled by threads
+ *       other than the query thread, so only functions with a plain combine step and fixed size values are accepted.
+ *       DISTINCT, ordered and list file based functions are not.
+ */
+bool
+qdata_is_partial_aggregate_supported (cubxasl::aggregate_list_node *agg_p)
+{
+  DB_TYPE value_type;
+
+  if (agg_p->option == Q_DISTINCT || agg_p->sort_list != NULL)
+    {
+      return false;
+    }
+
+  switch (agg_p->function)
+    {
+    case PT_COUNT_STAR:
+      return true;
+
+    case PT_COUNT:
+      /* only the number of values is kept */
+      return agg_p->operands != NULL && agg_p->operands->next == NULL;
+
+    case PT_MIN:
+    case PT_MAX:
+    case PT_SUM:
+    case PT_AVG:
+      if (agg_p->operands == NULL || agg_p->operands->next != NULL || agg_p->domain == NULL)
+	{
+	  return false;
+	}
+      value_type = TP_DOMAIN_TYPE (agg_p->domain);
+      return ((TP_IS_NUMERIC_TYPE (value_type) || TP_IS_DATE_OR_TIME_TYPE (value_type))
+	      && (TP_IS_NUMERIC_TYPE (agg_p->opr_dbtype) || TP_IS_DATE_OR_TIME_TYPE (agg_p->opr_dbtype)));
+
+    default:
+      return false;
+    }
+}
+
+/*
+ * qdata_aggregate_value_to_partial_accumulator () - aggregate a value to a partial accumulator
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   agg_p(in): aggregate node; only read
+ *   partial_acc(in/out): partial accumulator
+ *   value(in): operand value; ignored for COUNT(*)
+ *
+ * Note: Same as qdata_evaluate_aggregate_list for a single aggregate, except that the operand is already fetched
+ *       and the aggregate node is not changed. See qdata_is_partial_aggregate_supported.
+ */
+int
+qdata_aggregate_value_to_partial_accumulator (cubthread::entry *thread_p, cubxasl::aggregate_list_node *agg_p,
+    cubxasl::aggregate_accumulator *partial_acc, db_value *value)
+{
+  int error;
+
+  if (agg_p->function == PT_COUNT_STAR)
+    {
+      partial_acc->curr_cnt++;
+      return NO_ERROR;
+    }
+
+  if (value == NULL || DB_IS_NULL (value))
+    {
+      return NO_ERROR;
+    }
+
+  error = qdata_aggregate_value_to_accumulator (thread_p, partial_acc, &agg_p->accumulator_domain, agg_p->function,
+	  agg_p->domain, value, false);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  partial_acc->curr_cnt++;
+  return NO_ERROR;
+}
+
+/*
+ * qdata_combine_partial_accumulator () - combine a partial accumulator into the accumulator of the aggregate
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   agg_p(in/out): aggregate node
+ *   partial_acc(in): partial accumulator
+ */
+int
+qdata_combine_partial_accumulator (cubthread::entry *thread_p, cubxasl::aggregate_list_node *agg_p,
+				   cubxasl::aggregate_accumulator *partial_acc)
+{
+  if (partial_acc->curr_cnt < 1)
+    {
+      /* nothing was aggregated */
+      return NO_ERROR;
+    }
+
+  return qdata_aggregate_accumulator_to_accumulator (thread_p, &agg_p->accumulator, &agg_p->accumulator_domain,
+	 agg_p->function, agg_p->domain, partial_acc);
+}
+
 /*
  * qdata_evaluate_aggregate_optimize () -
  *   return:
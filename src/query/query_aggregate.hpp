@@ -123,6 +123,11 @@ int qdata_aggregate_accumulator_to_accumulator (cubthread::entry *thread_p, cubx
     tp_domain *func_domain, cubxasl::aggregate_accumulator *new_acc);
 int qdata_evaluate_aggregate_list (cubthread::entry *thread_p, cubxasl::aggregate_list_node *agg_list, val_descr *vd,
 				   cubxasl::aggregate_accumulator *alt_acc_list);
+bool qdata_is_partial_aggregate_supported (cubxasl::aggregate_list_node *agg_p);
+int qdata_aggregate_value_to_partial_accumulator (cubthread::entry *thread_p, cubxasl::aggregate_list_node *agg_p,
+    cubxasl::aggregate_accumulator *partial_acc, db_value *value);
+int qdata_combine_partial_accumulator (cubthread::entry *thread_p, cubxasl::aggregate_list_node *agg_p,
+				       cubxasl::aggregate_accumulator *partial_acc);
 int qdata_evaluate_aggregate_optimize (cubthread::entry *thread_p, cubxasl::aggregate_list_node *agg_ptr, HFID *hfid,
 				       OID *partition_cls_oid);
 int qdata_evaluate_aggregate_hierarchy (cubthread::entry *thread_p, cubxasl::aggregate_list_node *agg_ptr,
@@ -75,13 +75,18 @@
 #include "dbtype.h"
 #include "string_regex.hpp"
 #include "thread_entry.hpp"
+#include "thread_entry_task.hpp"
+#include "thread_manager.hpp"
 #include "regu_var.hpp"
 #include "xasl.h"
 #include "xasl_aggregate.hpp"
 #include "xasl_analytic.hpp"
 #include "xasl_predicate.hpp"
+#include "xasl_unpack_info.hpp"
 #include "subquery_cache.h"
 
+#include <condition_variable>
+#include <mutex>
 #include <vector>
 // XXX: SHOULD BE THE LAST INCLUDE HEADER
 #include "memory_wrapper.hpp"
@@ -92,6 +97,7 @@ struct xasl_state
 {
   VAL_DESCR vd;			/* Value Descriptor */
   QUERY_ID query_id;		/* Query associated with XASL */
+  XASL_NODE *root_xasl;		/* Root block of the XASL */
   int qp_xasl_line;		/* Error line */
 };
 
@@ -387,6 +393,16 @@ struct upddel_class_info_internal
   UPDATE_MVCC_REEV_ASSIGNMENT *mvcc_reev_assigns;
 };
 
+/* uncorrelated subquery whose tuples are pulled one at a time by the list scan of its parent */
+typedef struct qexec_pipe_source QEXEC_PIPE_SOURCE;
+struct qexec_pipe_source
+{
+  XASL_NODE *xasl;		/* subquery producing the tuples */
+  XASL_STATE *xasl_state;	/* XASL state of the query */
+  QFILE_TUPLE_RECORD tplrec;	/* last produced tuple */
+  SCAN_POSITION position;	/* position of the subquery scan */
+};
+
 enum analytic_stage
 {
   ANALYTIC_INTERM_PROC = 1,
@@ -485,6 +501,11 @@ static ANALYTIC_STATE *qexec_initialize_analytic_state (THREAD_ENTRY * thread_p,
 							QFILE_TUPLE_RECORD * tplrec);
 static SORT_STATUS qexec_analytic_get_next (THREAD_ENTRY * thread_p, RECDES * recdes, void *arg);
 static int qexec_analytic_put_next (THREAD_ENTRY * thread_p, const RECDES * recdes, void *arg);
+static SORT_STATUS qexec_analytic_read_sort_key (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analytic_state,
+						 RECDES * key);
+static int qexec_analytic_check_input_order (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analytic_state,
+					     bool * is_ordered);
+static int qexec_analytic_process_ordered_input (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analytic_state);
 static int qexec_analytic_eval_instnum_pred (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analytic_state,
 					     ANALYTIC_STAGE stage);
 static int qexec_analytic_start_group (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state,
@@ -569,6 +590,11 @@ static int qexec_open_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spe
 			    QUERY_ID query_id, SCAN_OPERATION_TYPE scan_op_type, bool scan_immediately_stop,
 			    bool * p_mvcc_select_lock_needed);
 static void qexec_close_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec);
+static bool qexec_is_pipelined_subquery (XASL_NODE * xasl, XASL_NODE * subquery);
+static int qexec_open_pipelined_subquery (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * list_spec,
+					  XASL_STATE * xasl_state);
+static SCAN_CODE qexec_next_pipelined_tuple (THREAD_ENTRY * thread_p, void *arg, QFILE_TUPLE_RECORD * tplrec);
+static void qexec_close_pipelined_subquery (THREAD_ENTRY * thread_p, void *arg);
 static void qexec_end_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec);
 static SCAN_CODE qexec_next_merge_block (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE ** spec);
 static SCAN_CODE qexec_next_scan_block (THREAD_ENTRY * thread_p, XASL_NODE * xasl);
@@ -625,6 +651,9 @@ static int qexec_process_partition_unique_stats (THREAD_ENTRY * thread_p, PRUNIN
 static int qexec_process_unique_stats (THREAD_ENTRY * thread_p, const OID * class_oid,
 				       UPDDEL_CLASS_INFO_INTERNAL * class_);
 static SCAN_CODE qexec_init_next_partition (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec);
+static void qexec_push_partition_prefetch (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec);
+static void qexec_start_partition_prefetch (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec);
+static void qexec_end_partition_prefetch (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec);
 
 static int qexec_check_limit_clause (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
 				     bool * empty_result);
@@ -686,6 +715,7 @@ static DB_VALUE_COMPARE_RESULT bf2df_str_cmpval (DB_VALUE * value1, DB_VALUE * v
 						 int *start_colp, int collation);
 static void qexec_resolve_domains_on_sort_list (SORT_LIST * order_list, REGU_VARIABLE_LIST reference_regu_list);
 static void qexec_resolve_domains_for_group_by (BUILDLIST_PROC_NODE * buildlist, OUTPTR_LIST * reference_out_list);
+static void qexec_resolve_sum_accumulator_domain (AGGREGATE_TYPE * agg_p, DB_TYPE opr_type, int opr_scale);
 static int qexec_resolve_domains_for_aggregation (THREAD_ENTRY * thread_p, AGGREGATE_TYPE * agg_p,
 						  XASL_STATE * xasl_state, QFILE_TUPLE_RECORD * tplrec,
 						  REGU_VARIABLE_LIST regu_list, int *resolved);
@@ -724,6 +754,16 @@ static int qexec_evaluate_aggregates_optimize (THREAD_ENTRY * thread_p, AGGREGAT
 					       ACCESS_SPEC_TYPE * spec, bool * is_scan_needed);
 static int qexec_evaluate_partition_aggregates (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec,
 						AGGREGATE_TYPE * agg_list, bool * is_scan_needed);
+// *INDENT-OFF*
+static cubthread::entry_workpool *qexec_get_worker_pool (void);
+// *INDENT-ON*
+static XASL_NODE *qexec_find_uncorrelated_block (XASL_NODE * xasl, XASL_NODE * block, int target, int *position);
+static bool qexec_is_regu_worker_safe (REGU_VARIABLE * regu);
+static bool qexec_is_regu_list_worker_safe (REGU_VARIABLE_LIST list);
+static bool qexec_is_pred_worker_safe (PRED_EXPR * pred);
+static bool qexec_is_parallel_aggregation_eligible (XASL_NODE * xasl);
+static int qexec_evaluate_aggregates_parallel (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
+					       bool * is_evaluated);
 
 static int qexec_setup_topn_proc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, VAL_DESCR * vd);
 static BH_CMP_RESULT qexec_topn_compare (const void *left, const void *right, BH_CMP_ARG arg);
@@ -1445,6 +1485,9 @@ qexec_clear_xasl_head (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
       qexec_clear_xasl_head (thread_p, xasl->connect_by_ptr);
     }
 
+  /* set by the execution, not by the plan */
+  XASL_CLEAR_FLAG (xasl, XASL_PIPELINED_SUBQUERY);
+
   if (xcache_uses_clones ())
     {
       if (XASL_IS_FLAGED (xasl, XASL_DECACHE_CLONE))
@@ -1885,6 +1928,7 @@ qexec_clear_access_spec_list (THREAD_ENTRY * thread_p, XASL_NODE * xasl_p, ACCES
 
       if (p->parts != NULL)
 	{
+	  qexec_end_partition_prefetch (thread_p, p);
 	  db_private_free (thread_p, p->parts);
 	  p->parts = NULL;
 	  p->curent = NULL;
@@ -9251,6 +9295,9 @@ qexec_open_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec, VAL_LIST
 
     case TARGET_LIST:
       /* open a list file scan */
+      /* the list file of a pipelined subquery is empty; its tuples are only seen by the scan it is attached to */
+      assert (ACCESS_SPEC_XASL_NODE (curr_spec) == NULL
+	      || !XASL_IS_FLAGED (ACCESS_SPEC_XASL_NODE (curr_spec), XASL_PIPELINED_SUBQUERY));
       if (ACCESS_SPEC_XASL_NODE (curr_spec) && ACCESS_SPEC_XASL_NODE (curr_spec)->spec_list == curr_spec)
 	{
 	  /* if XASL of access spec for list scan is itself then this is for HQ */
@@ -9374,6 +9421,7 @@ exit_on_error:
   if (curr_spec->pruning_type == DB_PARTITIONED_CLASS && curr_spec->parts != NULL)
     {
       /* reset pruning info */
+      qexec_end_partition_prefetch (thread_p, curr_spec);
       db_private_free (thread_p, curr_spec->parts);
       curr_spec->parts = NULL;
       curr_spec->curent = NULL;
@@ -9454,6 +9502,7 @@ qexec_close_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec)
   /* reset pruning info */
   if (curr_spec->type == TARGET_CLASS && curr_spec->parts != NULL)
     {
+      qexec_end_partition_prefetch (thread_p, curr_spec);
       db_private_free (thread_p, curr_spec->parts);
       curr_spec->parts = NULL;
       curr_spec->curent = NULL;
@@ -9469,6 +9518,294 @@ qexec_close_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec)
   scan_close_scan (thread_p, &curr_spec->s_id);
 }
 
+/*
+ * qexec_is_pipelined_subquery () - check whether an uncorrelated subquery can be pipelined into its parent
+ *   return: true if the subquery tuples can be pulled by the list scan of xasl instead of being materialized
+ *   xasl(in)   : XASL block owning the subquery in its aptr list
+ *   subquery(in)       : uncorrelated subquery
+ *
+ * Note: The parent must be executed only once and read the subquery through its single, outermost list scan, so
+ *       that the subquery is consumed exactly once and in scan order. The subquery must be a plain filtered
+ *       projection of one class: anything that needs the whole result before the first tuple (sorting, grouping,
+ *       analytic functions, DISTINCT, LIMIT, inst_num ()) or that runs other blocks per row is excluded.
+ */
+static bool
+qexec_is_pipelined_subquery (XASL_NODE * xasl, XASL_NODE * subquery)
+{
+  ACCESS_SPEC_TYPE *specp;
+
+  if (!prm_get_bool_value (PRM_ID_USE_PIPELINED_SUBQUERY_SCAN))
+    {
+      return false;
+    }
+
+  /* the consumer */
+  if (!XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) || (xasl->type != BUILDLIST_PROC && xasl->type != BUILDVALUE_PROC)
+      || xasl->scan_op_type != S_SELECT || xasl->selected_upd_list != NULL || xasl->merge_spec != NULL
+      || XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY) || xasl->max_iterations != -1)
+    {
+      return false;
+    }
+
+  specp = xasl->spec_list;
+  if (specp == NULL || specp->next != NULL || specp->type != TARGET_LIST || ACCESS_SPEC_XASL_NODE (specp) != subquery)
+    {
+      return false;
+    }
+
+  /* the producer */
+  if (subquery->type != BUILDLIST_PROC || subquery->scan_op_type != S_SELECT
+      || (subquery->status != XASL_CLEARED && subquery->status != XASL_INITIALIZED)
+      || XASL_IS_FLAGED (subquery, XASL_LINK_TO_REGU_VARIABLE | XASL_HAS_CONNECT_BY | XASL_USES_MRO
+			 | XASL_SAMPLING_SCAN) || QEXEC_IS_SUBQUERY_CACHE (subquery))
+    {
+      return false;
+    }
+
+  if (subquery->aptr_list != NULL || subquery->bptr_list != NULL || subquery->dptr_list != NULL
+      || subquery->fptr_list != NULL || subquery->scan_ptr != NULL || subquery->connect_by_ptr != NULL
+      || subquery->merge_spec != NULL || subquery->selected_upd_list != NULL)
+    {
+      return false;
+    }
+
+  if (subquery->orderby_list != NULL || subquery->after_iscan_list != NULL || subquery->option == Q_DISTINCT
+      || subquery->instnum_pred != NULL || subquery->instnum_val != NULL || subquery->ordbynum_val != NULL
+      || subquery->limit_offset != NULL || subquery->limit_row_count != NULL || subquery->is_single_tuple
+      || subquery->max_iterations != -1 || subquery->upd_del_class_cnt > 0)
+    {
+      return false;
+    }
+
+  if (subquery->proc.buildlist.groupby_list != NULL || subquery->proc.buildlist.g_agg_list != NULL
+      || subquery->proc.buildlist.a_eval_list != NULL || subquery->proc.buildlist.push_list_id != NULL)
+    {
+      return false;
+    }
+
+  specp = subquery->spec_list;
+  if (specp == NULL || specp->next != NULL || specp->type != TARGET_CLASS
+      || (specp->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
+      || (specp->access != ACCESS_METHOD_SEQUENTIAL && specp->access != ACCESS_METHOD_INDEX))
+    {
+      return false;
+    }
+
+  return true;
+}
+
+/*
+ * qexec_open_pipelined_subquery () - open the subquery read by a list scan and attach it to the scan
+ *   return: NO_ERROR, or ER_code
+ *   list_spec(in)      : opened list access specification reading the subquery
+ *   xasl_state(in)     : XASL state information
+ *
+ * Note: The subquery list file is opened so that the consumer sees its type list, but no tuple is written to it.
+ *       The subquery scan is advanced only when the consumer asks for the next tuple; it is closed together with
+ *       the list scan.
+ *       The subquery then looks executed (XASL_SUCCESS) although its list file stays empty (tuple_cnt is 0), so
+ *       nothing but the attached list scan may read subquery->list_id: it is flagged XASL_PIPELINED_SUBQUERY until
+ *       the scan is closed and opening another list scan on it, or rewinding the attached one, asserts.
+ */
+static int
+qexec_open_pipelined_subquery (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * list_spec, XASL_STATE * xasl_state)
+{
+  XASL_NODE *subquery = ACCESS_SPEC_XASL_NODE (list_spec);
+  QEXEC_PIPE_SOURCE *source;
+  int error;
+
+  assert (list_spec->s_id.type == S_LIST_SCAN);
+
+  source = (QEXEC_PIPE_SOURCE *) db_private_alloc (thread_p, sizeof (QEXEC_PIPE_SOURCE));
+  if (source == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (QEXEC_PIPE_SOURCE));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  source->xasl = subquery;
+  source->xasl_state = xasl_state;
+  source->position = S_BEFORE;
+  source->tplrec.size = DB_PAGESIZE;
+  source->tplrec.tpl = (QFILE_TUPLE) db_private_alloc (thread_p, DB_PAGESIZE);
+  if (source->tplrec.tpl == NULL)
+    {
+      db_private_free_and_init (thread_p, source);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) DB_PAGESIZE);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  error = qexec_start_mainblock_iterations (thread_p, subquery, xasl_state);
+  if (error != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+
+  /* no fixed scan: the consumer fixes pages of its own scans between two pulled tuples */
+  error = qexec_open_scan (thread_p, subquery->spec_list, subquery->val_list, &xasl_state->vd, false, false, false,
+			   subquery->iscan_oid_order, &subquery->spec_list->s_id, xasl_state->query_id, S_SELECT,
+			   false, NULL);
+  if (error != NO_ERROR)
+    {
+      qfile_close_list (thread_p, subquery->list_id);
+      goto exit_on_error;
+    }
+
+  subquery->curr_spec = NULL;
+  subquery->status = XASL_SUCCESS;
+  XASL_SET_FLAG (subquery, XASL_PIPELINED_SUBQUERY);
+
+  scan_attach_list_pipe (&list_spec->s_id, qexec_next_pipelined_tuple, qexec_close_pipelined_subquery, source);
+
+  return NO_ERROR;
+
+exit_on_error:
+  db_private_free_and_init (thread_p, source->tplrec.tpl);
+  db_private_free_and_init (thread_p, source);
+  subquery->status = XASL_FAILURE;
+
+  ASSERT_ERROR_AND_SET (error);
+  return error;
+}
+
+/*
+ * qexec_next_pipelined_tuple () - produce the next tuple of a pipelined subquery
+ *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
+ *   arg(in)    : QEXEC_PIPE_SOURCE of the subquery
+ *   tplrec(out)        : produced tuple; valid until the next call
+ *
+ * Note: This is the single-block part of qexec_intprt_fnc () followed by the projection that
+ *       qexec_end_one_iteration () would have written to the list file.
+ */
+static SCAN_CODE
+qexec_next_pipelined_tuple (THREAD_ENTRY * thread_p, void *arg, QFILE_TUPLE_RECORD * tplrec)
+{
+  QEXEC_PIPE_SOURCE *source = (QEXEC_PIPE_SOURCE *) arg;
+  XASL_NODE *xasl = source->xasl;
+  XASL_STATE *xasl_state = source->xasl_state;
+  SCAN_CODE sc;
+  DB_LOGICAL ev_res;
+
+  if (source->position == S_AFTER)
+    {
+      return S_END;
+    }
+
+  if (source->position == S_BEFORE)
+    {
+      sc = qexec_next_scan_block (thread_p, xasl);
+      if (sc != S_SUCCESS)
+	{
+	  goto end;
+	}
+      source->position = S_ON;
+    }
+
+  while (true)
+    {
+      sc = scan_next_scan (thread_p, &xasl->curr_spec->s_id);
+      if (sc == S_END)
+	{
+	  /* move to the next scan block or partition */
+	  sc = qexec_next_scan_block (thread_p, xasl);
+	  if (sc == S_SUCCESS)
+	    {
+	      continue;
+	    }
+	}
+      if (sc != S_SUCCESS)
+	{
+	  break;
+	}
+
+      if (xasl->after_join_pred != NULL)
+	{
+	  ev_res = eval_pred (thread_p, xasl->after_join_pred, &xasl_state->vd, NULL);
+	  if (ev_res == V_ERROR)
+	    {
+	      sc = S_ERROR;
+	      break;
+	    }
+	  else if (ev_res != V_TRUE)
+	    {
+	      continue;
+	    }
+	}
+
+      if (xasl->if_pred != NULL)
+	{
+	  ev_res = eval_pred (thread_p, xasl->if_pred, &xasl_state->vd, NULL);
+	  if (ev_res == V_ERROR)
+	    {
+	      sc = S_ERROR;
+	      break;
+	    }
+	  else if (ev_res != V_TRUE)
+	    {
+	      continue;
+	    }
+	}
+
+      if (qdata_copy_valptr_list_to_tuple (thread_p, xasl->outptr_list, &xasl_state->vd, &source->tplrec) !=
+	  NO_ERROR)
+	{
+	  sc = S_ERROR;
+	  break;
+	}
+
+      if (!xasl->list_id->is_domain_resolved
+	  && qfile_update_domains_on_type_list (thread_p, xasl->list_id, xasl->outptr_list) != NO_ERROR)
+	{
+	  sc = S_ERROR;
+	  break;
+	}
+
+      tplrec->tpl = source->tplrec.tpl;
+      tplrec->size = source->tplrec.size;
+
+      return S_SUCCESS;
+    }
+
+end:
+  source->position = S_AFTER;
+  if (sc == S_ERROR)
+    {
+      xasl->status = XASL_FAILURE;
+      qexec_failure_line (__LINE__, xasl_state);
+    }
+
+  return sc;
+}
+
+/*
+ * qexec_close_pipelined_subquery () - close the subquery of a pipelined list scan
+ *   return:
+ *   arg(in)    : QEXEC_PIPE_SOURCE of the subquery
+ */
+static void
+qexec_close_pipelined_subquery (THREAD_ENTRY * thread_p, void *arg)
+{
+  QEXEC_PIPE_SOURCE *source = (QEXEC_PIPE_SOURCE *) arg;
+  XASL_NODE *xasl = source->xasl;
+
+  if (xasl->curr_spec != NULL)
+    {
+      /* the consumer stopped before the end of the subquery, e.g. because of its LIMIT clause */
+      scan_end_scan (thread_p, &xasl->curr_spec->s_id);
+      xasl->curr_spec->curent = NULL;
+      xasl->curr_spec = NULL;
+    }
+  qexec_close_scan (thread_p, xasl->spec_list);
+  qfile_close_list (thread_p, xasl->list_id);
+  XASL_CLEAR_FLAG (xasl, XASL_PIPELINED_SUBQUERY);
+
+  if (source->tplrec.tpl != NULL)
+    {
+      db_private_free_and_init (thread_p, source->tplrec.tpl);
+    }
+  db_private_free (thread_p, source);
+}
+
 /*
  * qexec_end_scan () -
  *   return:
@@ -10220,78 +10557,392 @@ qexec_prune_spec (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec, VAL_DESCR *
   return NO_ERROR;
 }
 
+/* threads of the worker pool shared by the queries; upper bound of the parameters that size the work of a query */
+#define QEXEC_WORKER_POOL_SIZE 32
+
+// *INDENT-OFF*
+namespace cubquery
+{
+  //
+  // worker_entry_manager - the workers a query hands work to run as system workers
+  //
+  // they never take the transaction of the query: whatever they need from it (snapshot, locks) is prepared by the
+  // query thread before the work is pushed.
+  //
+  class worker_entry_manager : public cubthread::entry_manager
+  {
+    protected:
+      void on_create (context_type &context) override;
+      void on_retire (context_type &context) override;
+      void on_recycle (context_type &context) override;
+  };
+
+  void
+  worker_entry_manager::on_create (context_type &context)
+  {
+    context.claim_system_worker ();
+  }
+
+  void
+  worker_entry_manager::on_retire (context_type &context)
+  {
+    context.retire_system_worker ();
+  }
+
+  void
+  worker_entry_manager::on_recycle (context_type &context)
+  {
+    context.tran_index = LOG_SYSTEM_TRAN_INDEX;
+  }
+}
+
+static std::mutex qexec_Worker_pool_mutex;
+static cubquery::worker_entry_manager qexec_Worker_entry_manager;
+static cubthread::entry_workpool *qexec_Worker_pool = NULL;
+// *INDENT-ON*
+
 /*
- * qexec_init_next_partition () - move to the next partition in the list
- * return : S_END if there are no more partitions, S_SUCCESS on success,
- *	    S_ERROR on error
- * thread_p (in) :
- * spec (in)	 : spec for which to move to the next partition
+ * qexec_get_worker_pool () - get the worker pool shared by the queries
+ * return : worker pool or NULL if there is none (SA_MODE)
+ *
+ * Note: The pool is created by the first query that needs it and its threads are started on demand. Each query keeps
+ *	 its own number of tasks within the limit of its parameter.
  */
-static SCAN_CODE
-qexec_init_next_partition (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec)
+// *INDENT-OFF*
+static cubthread::entry_workpool *
+qexec_get_worker_pool (void)
+// *INDENT-ON*
 {
-  int error = NO_ERROR;
-  SCAN_OPERATION_TYPE scan_op_type = spec->s_id.scan_op_type;
-  bool mvcc_select_lock_needed = spec->s_id.mvcc_select_lock_needed;
-  int fixed = spec->s_id.fixed;
-  int grouped = spec->s_id.grouped;
-  QPROC_SINGLE_FETCH single_fetch = spec->s_id.single_fetch;
-  VAL_LIST *val_list = spec->s_id.val_list;
-  VAL_DESCR *vd = spec->s_id.vd;
-  bool iscan_oid_order = spec->s_id.s.isid.iscan_oid_order;
-  INDX_INFO *idxptr = NULL;
-  QUERY_ID query_id = spec->s_id.s.isid.indx_cov.query_id;
-  OID class_oid;
-  HFID class_hfid;
-  BTID btid;
+  std::lock_guard < std::mutex > lock (qexec_Worker_pool_mutex);
 
-  if (spec->type != TARGET_CLASS && spec->type != TARGET_CLASS_ATTR)
+  if (qexec_Worker_pool == NULL)
     {
-      return S_END;
+      qexec_Worker_pool =
+	thread_get_manager ()->create_worker_pool (QEXEC_WORKER_POOL_SIZE, QEXEC_WORKER_POOL_SIZE, "query workers",
+						   &qexec_Worker_entry_manager, 1, false);
     }
 
-  if (spec->parts == NULL)
-    {
-      return S_END;
-    }
+  return qexec_Worker_pool;
+}
 
-  if (spec->curent == NULL)
-    {
-      spec->curent = spec->parts;
-    }
-  else
+/*
+ * qexec_finalize_worker_pool () - destroy the worker pool shared by the queries
+ * return : void
+ */
+void
+qexec_finalize_worker_pool (void)
+{
+  std::lock_guard < std::mutex > lock (qexec_Worker_pool_mutex);
+
+  if (qexec_Worker_pool != NULL)
     {
-      if (spec->curent->next == NULL)
-	{
-	  /* no more partitions */
-	  spec->curent = NULL;
-	}
-      else
-	{
-	  spec->curent = spec->curent->next;
-	}
+      thread_get_manager ()->destroy_worker_pool (qexec_Worker_pool);
+      qexec_Worker_pool = NULL;
     }
-  /* close current scan and open a new one on the next partition */
-  scan_end_scan (thread_p, &spec->s_id);
-  scan_close_scan (thread_p, &spec->s_id);
+}
 
-  /* we also need to reset caches for attributes */
-  qexec_reset_regu_variable_list (spec->s.cls_node.cls_regu_list_pred);
-  qexec_reset_regu_variable_list (spec->s.cls_node.cls_regu_list_rest);
-  qexec_reset_regu_variable_list (spec->s.cls_node.cls_regu_list_key);
-  qexec_reset_pred_expr (spec->where_pred);
-  qexec_reset_pred_expr (spec->where_key);
+// *INDENT-OFF*
+namespace cubquery
+{
+  //
+  // partition_prefetch - reads ahead the heap pages of the partitions a sequential scan has not reached yet
+  //
+  // the scan itself still goes through the partitions one by one on the query thread; the next partitions are handed
+  // to the shared worker pool, which walks their heap chains and loads the pages in the page buffer, so that the
+  // partitions are read from disk in parallel. only a window of partitions ahead of the scan is read, and the window
+  // moves with the scan, so that the pages are not evicted before the scan gets there.
+  //
+  class partition_prefetch
+  {
+    public:
+      PARTITION_SPEC_TYPE *m_next_part;	// first partition not handed to the workers yet
+      int m_max_pages;			// pages read ahead in each partition
+      std::atomic_bool m_stop;
+      std::mutex m_mutex;
+      std::condition_variable m_cond;
+      int m_tasks_pending;		// protected by m_mutex
+
+      partition_prefetch ()
+	: m_next_part (NULL)
+	, m_max_pages (0)
+	, m_stop (false)
+	, m_mutex ()
+	, m_cond ()
+	, m_tasks_pending (0)
+      {
+      }
 
-  if (spec->curent == NULL)
-    {
-      /* reset back to root class */
-      COPY_OID (&class_oid, &ACCESS_SPEC_CLS_OID (spec));
-      HFID_COPY (&class_hfid, &ACCESS_SPEC_HFID (spec));
-      if (IS_ANY_INDEX_ACCESS (spec->access))
-	{
-	  btid = spec->btid;
-	}
-    }
+      void notify_task_done ()
+      {
+	std::lock_guard<std::mutex> lock (m_mutex);
+	m_tasks_pending--;
+	m_cond.notify_one ();
+      }
+  };
+
+  class partition_prefetch_task : public cubthread::entry_task
+  {
+    public:
+      partition_prefetch_task (const HFID &hfid, partition_prefetch &context)
+	: m_hfid (hfid)
+	, m_context (context)
+      {
+      }
+
+      void execute (cubthread::entry &thread_ref) override;
+
+    private:
+      HFID m_hfid;
+      partition_prefetch &m_context;
+  };
+
+  void
+  partition_prefetch_task::execute (cubthread::entry &thread_ref)
+  {
+    PGBUF_WATCHER curr_watcher;
+    PGBUF_WATCHER old_watcher;
+    VPID vpid;
+    int npages;
+
+    PGBUF_INIT_WATCHER (&curr_watcher, PGBUF_ORDERED_HEAP_NORMAL, &m_hfid);
+    PGBUF_INIT_WATCHER (&old_watcher, PGBUF_ORDERED_HEAP_NORMAL, &m_hfid);
+
+    /* start from the heap header page and follow the chain */
+    vpid.volid = m_hfid.vfid.volid;
+    vpid.pageid = m_hfid.hpgid;
+
+    for (npages = 0; npages < m_context.m_max_pages && !VPID_ISNULL (&vpid); npages++)
+      {
+	if (m_context.m_stop || thread_ref.shutdown)
+	  {
+	    break;
+	  }
+
+	pgbuf_replace_watcher (&thread_ref, &curr_watcher, &old_watcher);
+	if (pgbuf_ordered_fix (&thread_ref, &vpid, OLD_PAGE_PREVENT_DEALLOC, PGBUF_LATCH_READ, &curr_watcher) != NO_ERROR)
+	  {
+	    /* only a hint; the scan reads the page again and handles the error */
+	    er_clear ();
+	    break;
+	  }
+	if (old_watcher.pgptr != NULL)
+	  {
+	    pgbuf_ordered_unfix (&thread_ref, &old_watcher);
+	  }
+
+	if (heap_vpid_next (&thread_ref, &m_hfid, curr_watcher.pgptr, &vpid) != NO_ERROR)
+	  {
+	    er_clear ();
+	    break;
+	  }
+      }
+
+    if (old_watcher.pgptr != NULL)
+      {
+	pgbuf_ordered_unfix (&thread_ref, &old_watcher);
+      }
+    if (curr_watcher.pgptr != NULL)
+      {
+	pgbuf_ordered_unfix (&thread_ref, &curr_watcher);
+      }
+
+    m_context.notify_task_done ();
+  }
+}
+// *INDENT-ON*
+
+/*
+ * qexec_push_partition_prefetch () - hand the next partition of the read-ahead window to the workers
+ * return : void
+ * thread_p (in) :
+ * spec (in)	 : partitioned spec with read-ahead
+ */
+static void
+qexec_push_partition_prefetch (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec)
+{
+  PARTITION_PREFETCH *prefetch = spec->parts_prefetch;
+  cubthread::entry_workpool *workpool;
+  PARTITION_SPEC_TYPE *part;
+
+  if (prefetch == NULL || prefetch->m_next_part == NULL)
+    {
+      return;
+    }
+
+  workpool = qexec_get_worker_pool ();
+  if (workpool == NULL)
+    {
+      return;
+    }
+
+  part = prefetch->m_next_part;
+  prefetch->m_next_part = part->next;
+
+  prefetch->m_mutex.lock ();
+  prefetch->m_tasks_pending++;
+  prefetch->m_mutex.unlock ();
+
+  thread_get_manager ()->push_task (workpool, new cubquery::partition_prefetch_task (part->hfid, *prefetch));
+}
+
+/*
+ * qexec_start_partition_prefetch () - start reading ahead the partitions of a sequential scan
+ * return : void
+ * thread_p (in) :
+ * spec (in)	 : partitioned spec that moves to its first partition
+ *
+ * Note: The first partition is scanned right away by the calling thread; the next partition_scan_prefetch_threads
+ *	 partitions are given to the shared worker pool, which loads their heap pages, and one more is given each time
+ *	 the scan moves to the next partition. The read-ahead of the window is bounded to a quarter of the page buffer.
+ *	 Without a worker pool the scan simply runs without read-ahead.
+ */
+static void
+qexec_start_partition_prefetch (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec)
+{
+  PARTITION_PREFETCH *prefetch;
+  PARTITION_SPEC_TYPE *part;
+  int thread_count, part_count, i;
+
+  thread_count = prm_get_integer_value (PRM_ID_PARTITION_SCAN_PREFETCH_THREADS);
+  if (thread_count <= 0 || spec->parts_prefetch != NULL)
+    {
+      return;
+    }
+
+  if (spec->type != TARGET_CLASS || spec->access != ACCESS_METHOD_SEQUENTIAL || spec->parts == NULL)
+    {
+      return;
+    }
+
+  part_count = 0;
+  for (part = spec->parts->next; part != NULL; part = part->next)
+    {
+      part_count++;
+    }
+  if (part_count == 0 || qexec_get_worker_pool () == NULL)
+    {
+      return;
+    }
+
+  thread_count = MIN (thread_count, part_count);
+
+  prefetch = new cubquery::partition_prefetch ();
+  prefetch->m_next_part = spec->parts->next;
+  prefetch->m_max_pages = MAX (prm_get_integer_value (PRM_ID_PB_NBUFFERS) / (4 * thread_count), 1);
+  spec->parts_prefetch = prefetch;
+
+  for (i = 0; i < thread_count; i++)
+    {
+      qexec_push_partition_prefetch (thread_p, spec);
+    }
+}
+
+/*
+ * qexec_end_partition_prefetch () - stop the read-ahead of a partitioned spec
+ * return : void
+ * thread_p (in) :
+ * spec (in)	 : partitioned spec
+ */
+static void
+qexec_end_partition_prefetch (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec)
+{
+  PARTITION_PREFETCH *prefetch = spec->parts_prefetch;
+
+  if (prefetch == NULL)
+    {
+      return;
+    }
+
+  /* the tasks use the context; wait for them */
+  prefetch->m_stop = true;
+  {
+    // *INDENT-OFF*
+    std::unique_lock<std::mutex> lock (prefetch->m_mutex);
+    prefetch->m_cond.wait (lock, [prefetch] { return prefetch->m_tasks_pending == 0; });
+    // *INDENT-ON*
+  }
+
+  delete prefetch;
+  spec->parts_prefetch = NULL;
+}
+
+/*
+ * qexec_init_next_partition () - move to the next partition in the list
+ * return : S_END if there are no more partitions, S_SUCCESS on success,
+ *	    S_ERROR on error
+ * thread_p (in) :
+ * spec (in)	 : spec for which to move to the next partition
+ */
+static SCAN_CODE
+qexec_init_next_partition (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec)
+{
+  int error = NO_ERROR;
+  SCAN_OPERATION_TYPE scan_op_type = spec->s_id.scan_op_type;
+  bool mvcc_select_lock_needed = spec->s_id.mvcc_select_lock_needed;
+  int fixed = spec->s_id.fixed;
+  int grouped = spec->s_id.grouped;
+  QPROC_SINGLE_FETCH single_fetch = spec->s_id.single_fetch;
+  VAL_LIST *val_list = spec->s_id.val_list;
+  VAL_DESCR *vd = spec->s_id.vd;
+  bool iscan_oid_order = spec->s_id.s.isid.iscan_oid_order;
+  INDX_INFO *idxptr = NULL;
+  QUERY_ID query_id = spec->s_id.s.isid.indx_cov.query_id;
+  OID class_oid;
+  HFID class_hfid;
+  BTID btid;
+
+  if (spec->type != TARGET_CLASS && spec->type != TARGET_CLASS_ATTR)
+    {
+      return S_END;
+    }
+
+  if (spec->parts == NULL)
+    {
+      return S_END;
+    }
+
+  if (spec->curent == NULL)
+    {
+      spec->curent = spec->parts;
+      qexec_start_partition_prefetch (thread_p, spec);
+    }
+  else
+    {
+      if (spec->curent->next == NULL)
+	{
+	  /* no more partitions */
+	  spec->curent = NULL;
+	  qexec_end_partition_prefetch (thread_p, spec);
+	}
+      else
+	{
+	  spec->curent = spec->curent->next;
+
+	  /* move the read-ahead window */
+	  qexec_push_partition_prefetch (thread_p, spec);
+	}
+    }
+  /* close current scan and open a new one on the next partition */
+  scan_end_scan (thread_p, &spec->s_id);
+  scan_close_scan (thread_p, &spec->s_id);
+
+  /* we also need to reset caches for attributes */
+  qexec_reset_regu_variable_list (spec->s.cls_node.cls_regu_list_pred);
+  qexec_reset_regu_variable_list (spec->s.cls_node.cls_regu_list_rest);
+  qexec_reset_regu_variable_list (spec->s.cls_node.cls_regu_list_key);
+  qexec_reset_pred_expr (spec->where_pred);
+  qexec_reset_pred_expr (spec->where_key);
+
+  if (spec->curent == NULL)
+    {
+      /* reset back to root class */
+      COPY_OID (&class_oid, &ACCESS_SPEC_CLS_OID (spec));
+      HFID_COPY (&class_hfid, &ACCESS_SPEC_HFID (spec));
+      if (IS_ANY_INDEX_ACCESS (spec->access))
+	{
+	  btid = spec->btid;
+	}
+    }
   else
     {
       COPY_OID (&class_oid, &spec->curent->oid);
@@ -10495,6 +11146,21 @@ qexec_intprt_fnc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_s
 	      return S_SUCCESS;
 	    }
 
+	  if (!buildvalue->is_always_false)
+	    {
+	      bool is_evaluated = false;
+
+	      error = qexec_evaluate_aggregates_parallel (thread_p, xasl, xasl_state, &is_evaluated);
+	      if (error != NO_ERROR)
+		{
+		  return S_ERROR;
+		}
+	      if (is_evaluated)
+		{
+		  return S_SUCCESS;
+		}
+	    }
+
 	  agg_ptr = buildvalue->agg_list;
 	  /* check only one count(*) function
 	   * TO_DO : this routine can be moved to XASL generator */
@@ -16743,6 +17409,12 @@ qexec_execute_mainblock_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XAS
 		  continue;
 		}
 
+	      if (xptr == xasl && qexec_is_pipelined_subquery (xasl, xptr2))
+		{
+		  /* skip; the list scan on it pulls its tuples while the main block is processed */
+		  continue;
+		}
+
 	      if (xptr2->status == XASL_CLEARED || xptr2->status == XASL_INITIALIZED)
 		{
 		  if (QEXEC_IS_SUBQUERY_CACHE (xptr2))
@@ -16961,6 +17633,16 @@ qexec_execute_mainblock_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XAS
 			      GOTO_EXIT_ON_ERROR;
 			    }
 
+			  if (level == 0 && specp->type == TARGET_LIST
+			      && qexec_is_pipelined_subquery (xasl, ACCESS_SPEC_XASL_NODE (specp)))
+			    {
+			      if (qexec_open_pipelined_subquery (thread_p, specp, xasl_state) != NO_ERROR)
+				{
+				  qexec_clear_mainblock_iterations (thread_p, xasl);
+				  GOTO_EXIT_ON_ERROR;
+				}
+			    }
+
 			  if (p_class_instance_lock_info && specp->type == TARGET_CLASS
 			      && OID_EQ (&specp->s.cls_node.cls_oid, &p_class_instance_lock_info->class_oid)
 			      && mvcc_select_lock_needed)
@@ -17567,6 +18249,7 @@ qexec_execute_query (THREAD_ENTRY * thread_p, xasl_node * xasl, int dbval_cnt, c
 
   /* save the query_id into the XASL state struct */
   xasl_state.query_id = query_id;
+  xasl_state.root_xasl = xasl;
 
   /* initialize error line */
   xasl_state.qp_xasl_line = 0;
@@ -21308,6 +21991,47 @@ qexec_resolve_domains_for_group_by (BUILDLIST_PROC_NODE * buildlist, OUTPTR_LIST
     }
 }
 
+/*
+ * qexec_resolve_sum_accumulator_domain () - set the accumulator domains of SUM and AVG
+ *   returns: nothing
+ *   agg_p(in/out): SUM or AVG aggregate node with a resolved function domain
+ *   opr_type(in): type of the operand values
+ *   opr_scale(in): scale of the operand values
+ */
+static void
+qexec_resolve_sum_accumulator_domain (AGGREGATE_TYPE * agg_p, DB_TYPE opr_type, int opr_scale)
+{
+  assert (agg_p->function == PT_SUM || agg_p->function == PT_AVG);
+
+  if (TP_IS_NUMERIC_TYPE (opr_type))
+    {
+      if (TP_DOMAIN_TYPE (agg_p->domain) == DB_TYPE_NUMERIC)
+	{
+	  agg_p->accumulator_domain.value_dom =
+	    tp_domain_resolve (DB_TYPE_NUMERIC, NULL, DB_MAX_NUMERIC_PRECISION, agg_p->domain->scale, NULL, 0);
+	}
+      else if (opr_type == DB_TYPE_NUMERIC)
+	{
+	  agg_p->accumulator_domain.value_dom =
+	    tp_domain_resolve (DB_TYPE_NUMERIC, NULL, DB_MAX_NUMERIC_PRECISION, opr_scale, NULL, 0);
+	}
+      else if (opr_type == DB_TYPE_FLOAT)
+	{
+	  agg_p->accumulator_domain.value_dom =
+	    tp_domain_resolve (DB_TYPE_DOUBLE, NULL, DB_DOUBLE_DECIMAL_PRECISION, opr_scale, NULL, 0);
+	}
+      else
+	{
+	  agg_p->accumulator_domain.value_dom = tp_domain_resolve_default (opr_type);
+	}
+    }
+  else
+    {
+      agg_p->accumulator_domain.value_dom = agg_p->domain;
+    }
+  agg_p->accumulator_domain.value2_dom = &tp_Null_domain;
+}
+
 /*
  * qexec_resolve_domains_for_aggregation () - update domains of aggregate
  *                                            functions and accumulators
@@ -21435,36 +22159,7 @@ qexec_resolve_domains_for_aggregation (THREAD_ENTRY * thread_p, AGGREGATE_TYPE *
 
 	    case PT_AVG:
 	    case PT_SUM:
-	      if (TP_IS_NUMERIC_TYPE (DB_VALUE_TYPE (dbval)))
-		{
-		  if (TP_DOMAIN_TYPE (agg_p->domain) == DB_TYPE_NUMERIC)
-		    {
-		      agg_p->accumulator_domain.value_dom =
-			tp_domain_resolve (DB_TYPE_NUMERIC, NULL, DB_MAX_NUMERIC_PRECISION, agg_p->domain->scale, NULL,
-					   0);
-		    }
-		  else if (DB_VALUE_TYPE (dbval) == DB_TYPE_NUMERIC)
-		    {
-		      agg_p->accumulator_domain.value_dom =
-			tp_domain_resolve (DB_TYPE_NUMERIC, NULL, DB_MAX_NUMERIC_PRECISION, DB_VALUE_SCALE (dbval),
-					   NULL, 0);
-		    }
-		  else if (DB_VALUE_TYPE (dbval) == DB_TYPE_FLOAT)
-		    {
-		      agg_p->accumulator_domain.value_dom =
-			tp_domain_resolve (DB_TYPE_DOUBLE, NULL, DB_DOUBLE_DECIMAL_PRECISION, DB_VALUE_SCALE (dbval),
-					   NULL, 0);
-		    }
-		  else
-		    {
-		      agg_p->accumulator_domain.value_dom = tp_domain_resolve_default (DB_VALUE_TYPE (dbval));
-		    }
-		}
-	      else
-		{
-		  agg_p->accumulator_domain.value_dom = agg_p->domain;
-		}
-	      agg_p->accumulator_domain.value2_dom = &tp_Null_domain;
+	      qexec_resolve_sum_accumulator_domain (agg_p, DB_VALUE_TYPE (dbval), DB_VALUE_SCALE (dbval));
 	      break;
 
 	    case PT_STDDEV:
@@ -22084,6 +22779,7 @@ qexec_execute_analytic (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
   int ls_flag = 0;
   int estimated_pages;
   bool finalized = false;
+  bool is_input_ordered = false;
   int i = 0;
   ANALYTIC_TYPE *func_p = NULL;
 
@@ -22206,9 +22902,22 @@ qexec_execute_analytic (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
   analytic_state.key_info.use_original = 1;
   analytic_state.cmp_fn = &qfile_compare_partial_sort_record;
 
-  if (sort_listfile (thread_p, NULL_VOLID, estimated_pages, &qexec_analytic_get_next, &analytic_state,
-		     &qexec_analytic_put_next, &analytic_state, analytic_state.cmp_fn, &analytic_state.key_info,
-		     SORT_DUP, NO_SORT_LIMIT, analytic_state.output_file->tfile_vfid->tde_encrypted) != NO_ERROR)
+  /* input that is already in the order of the sort keys is processed in a single pass, without sorting */
+  if (qexec_analytic_check_input_order (thread_p, &analytic_state, &is_input_ordered) != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  if (is_input_ordered)
+    {
+      if (qexec_analytic_process_ordered_input (thread_p, &analytic_state) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+  else if (sort_listfile (thread_p, NULL_VOLID, estimated_pages, &qexec_analytic_get_next, &analytic_state,
+			  &qexec_analytic_put_next, &analytic_state, analytic_state.cmp_fn, &analytic_state.key_info,
+			  SORT_DUP, NO_SORT_LIMIT, analytic_state.output_file->tfile_vfid->tde_encrypted) != NO_ERROR)
     {
       GOTO_EXIT_ON_ERROR;
     }
@@ -22788,20 +23497,177 @@ exit_on_error:
 }
 
 /*
- * qexec_analytic_eval_instnum_pred () - evaluate inst_num() predicate
- *   returns: error code or NO_ERROR
- *   thread_p(in): current thread
+ * qexec_analytic_read_sort_key () - read the sort key of the next input tuple
+ *   return: SORT_SUCCESS, SORT_NOMORE_RECS or SORT_ERROR_OCCURRED
+ *   thread_p(in): thread entry
  *   analytic_state(in): analytic state
- *   func_p(in): analytic function chain
- *   stage(in): stage from within function is called
- *
- * NOTE: this function sets the analytic state's "is_output_rec" flag
+ *   key(in/out): sort key record; its area is enlarged as needed
  */
-static int
-qexec_analytic_eval_instnum_pred (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analytic_state, ANALYTIC_STAGE stage)
+static SORT_STATUS
+qexec_analytic_read_sort_key (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analytic_state, RECDES * key)
 {
-  ANALYTIC_STAGE instnum_stage = ANALYTIC_INTERM_PROC;
-  DB_LOGICAL is_output_rec;
+  SORT_STATUS status;
+  char *tmp;
+
+  while (true)
+    {
+      status = qexec_analytic_get_next (thread_p, key, analytic_state);
+      if (status != SORT_REC_DOESNT_FIT)
+	{
+	  return status;
+	}
+
+      /* the scan was moved back to the tuple; enlarge the key area and retry */
+      tmp = (char *) db_private_realloc (thread_p, key->data, key->length);
+      if (tmp == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) key->length);
+	  return SORT_ERROR_OCCURRED;
+	}
+      key->data = tmp;
+      key->area_size = key->length;
+    }
+}
+
+/*
+ * qexec_analytic_check_input_order () - check if the input is already ordered by the analytic sort keys
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread entry
+ *   analytic_state(in): analytic state with an opened input scan
+ *   is_ordered(out): true if no tuple is out of order
+ *
+ * NOTE: The input is read up to the first tuple that is out of order and the scan is reopened afterwards. Input
+ *       that comes from an index scan, or from a previous analytic run with a compatible sort list, is found
+ *       ordered and does not need to be sorted again.
+ */
+static int
+qexec_analytic_check_input_order (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analytic_state, bool * is_ordered)
+{
+  RECDES keys[2] = { RECDES_INITIALIZER, RECDES_INITIALIZER };
+  SORT_STATUS status;
+  int curr = 0, count = 0, i;
+  int error = NO_ERROR;
+
+  *is_ordered = true;
+
+  for (i = 0; i < 2; i++)
+    {
+      keys[i].data = (char *) db_private_alloc (thread_p, DB_PAGESIZE);
+      if (keys[i].data == NULL)
+	{
+	  error = ER_OUT_OF_VIRTUAL_MEMORY;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, (size_t) DB_PAGESIZE);
+	  goto end;
+	}
+      keys[i].area_size = DB_PAGESIZE;
+    }
+
+  while ((status = qexec_analytic_read_sort_key (thread_p, analytic_state, &keys[curr])) == SORT_SUCCESS)
+    {
+      if (count > 0
+	  && (*analytic_state->cmp_fn) (&keys[1 - curr].data, &keys[curr].data, &analytic_state->key_info) > 0)
+	{
+	  *is_ordered = false;
+	  break;
+	}
+      if (analytic_state->key_info.error != NO_ERROR)
+	{
+	  /* let the sort report it */
+	  *is_ordered = false;
+	  break;
+	}
+
+      count++;
+      curr = 1 - curr;
+    }
+
+  if (status == SORT_ERROR_OCCURRED)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      goto end;
+    }
+
+  /* rewind the input */
+  qfile_close_scan (thread_p, analytic_state->input_scan);
+  if (qfile_open_list_scan (analytic_state->xasl->list_id, analytic_state->input_scan) != NO_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      goto end;
+    }
+
+end:
+  analytic_state->key_info.error = NO_ERROR;
+
+  for (i = 0; i < 2; i++)
+    {
+      if (keys[i].data != NULL)
+	{
+	  db_private_free_and_init (thread_p, keys[i].data);
+	}
+    }
+
+  return error;
+}
+
+/*
+ * qexec_analytic_process_ordered_input () - evaluate the analytic functions on input that is already ordered
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread entry
+ *   analytic_state(in): analytic state with an opened input scan
+ *
+ * NOTE: The tuples are fed to qexec_analytic_put_next () one by one in input order, in place of the output of
+ *       sort_listfile ().
+ */
+static int
+qexec_analytic_process_ordered_input (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analytic_state)
+{
+  RECDES key = RECDES_INITIALIZER;
+  SORT_STATUS status;
+  int error = NO_ERROR;
+
+  key.data = (char *) db_private_alloc (thread_p, DB_PAGESIZE);
+  if (key.data == NULL)
+    {
+      error = ER_OUT_OF_VIRTUAL_MEMORY;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, (size_t) DB_PAGESIZE);
+      return error;
+    }
+  key.area_size = DB_PAGESIZE;
+
+  while ((status = qexec_analytic_read_sort_key (thread_p, analytic_state, &key)) == SORT_SUCCESS)
+    {
+      error = qexec_analytic_put_next (thread_p, &key, analytic_state);
+      if (error != NO_ERROR)
+	{
+	  break;
+	}
+    }
+
+  if (error == NO_ERROR && status == SORT_ERROR_OCCURRED)
+    {
+      ASSERT_ERROR_AND_SET (error);
+    }
+
+  db_private_free_and_init (thread_p, key.data);
+
+  return error;
+}
+
+/*
+ * qexec_analytic_eval_instnum_pred () - evaluate inst_num() predicate
+ *   returns: error code or NO_ERROR
+ *   thread_p(in): current thread
+ *   analytic_state(in): analytic state
+ *   func_p(in): analytic function chain
+ *   stage(in): stage from within function is called
+ *
+ * NOTE: this function sets the analytic state's "is_output_rec" flag
+ */
+static int
+qexec_analytic_eval_instnum_pred (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analytic_state, ANALYTIC_STAGE stage)
+{
+  ANALYTIC_STAGE instnum_stage = ANALYTIC_INTERM_PROC;
+  DB_LOGICAL is_output_rec;
   int instnum_flag, i;
 
   /* get flag from buildlist */
@@ -26676,6 +27542,928 @@ qexec_evaluate_aggregates_optimize (THREAD_ENTRY * thread_p, AGGREGATE_TYPE * ag
   return error;
 }
 
+// *INDENT-OFF*
+namespace cubquery
+{
+  //
+  // parallel_aggregation - aggregates of a partitioned class computed by the tasks of the shared worker pool
+  //
+  // every task takes the next partition that is not scanned yet and aggregates its values into the partial
+  // accumulators of the partition; the query thread combines the partial accumulators once all tasks are done.
+  // the tasks run as system workers: the query thread has locked the partitions and hands them its snapshot.
+  //
+  // predicates and operands cannot be evaluated on the XASL of the query thread, which keeps the fetched values and
+  // the attribute caches in its nodes. every task unpacks its own copy of the XASL from the stream of the query and
+  // evaluates them on the copy of the block, with its own copy of the value descriptor.
+  //
+  class parallel_aggregation
+  {
+    public:
+      struct partial_result
+      {
+	std::vector<DB_VALUE> values;	// value and value2 of each accumulator
+	std::vector<AGGREGATE_ACCUMULATOR> accumulators;
+      };
+
+      AGGREGATE_TYPE *m_agg_list;
+      std::vector<PARTITION_SPEC_TYPE *> m_parts;
+      std::vector<partial_result> m_results;	// one for each partition
+      MVCC_SNAPSHOT *m_snapshot;
+      char *m_xasl_stream;
+      int m_xasl_stream_size;
+      int m_block_position;	// position of the block in the XASL, see qexec_find_uncorrelated_block
+      XASL_STATE *m_xasl_state;	// state of the query thread; its value descriptor is copied by every task
+      thread_id_t m_query_thread_id;
+      std::atomic<std::size_t> m_next_part;
+      std::atomic_bool m_stop;
+      std::atomic_bool m_has_error;
+      std::mutex m_mutex;
+      std::condition_variable m_cond;
+      std::size_t m_tasks_done;	// protected by m_mutex
+
+      parallel_aggregation ()
+	: m_agg_list (NULL)
+	, m_parts ()
+	, m_results ()
+	, m_snapshot (NULL)
+	, m_xasl_stream (NULL)
+	, m_xasl_stream_size (0)
+	, m_block_position (-1)
+	, m_xasl_state (NULL)
+	, m_query_thread_id ()
+	, m_next_part (0)
+	, m_stop (false)
+	, m_has_error (false)
+	, m_mutex ()
+	, m_cond ()
+	, m_tasks_done (0)
+      {
+      }
+
+      void notify_task_done ()
+      {
+	std::lock_guard<std::mutex> lock (m_mutex);
+	m_tasks_done++;
+	m_cond.notify_one ();
+      }
+  };
+
+  class parallel_aggregation_task : public cubthread::entry_task
+  {
+    public:
+      parallel_aggregation_task (parallel_aggregation &context)
+	: m_context (context)
+	, m_xasl (NULL)
+	, m_xasl_buf (NULL)
+	, m_block (NULL)
+	, m_xasl_state ()
+	, m_host_vars ()
+      {
+      }
+
+      void execute (cubthread::entry &thread_ref) override;
+
+    private:
+      int start_block (cubthread::entry &thread_ref);
+      void end_block (cubthread::entry &thread_ref);
+      int aggregate_partition (cubthread::entry &thread_ref, std::size_t index);
+
+      parallel_aggregation &m_context;
+      XASL_NODE *m_xasl;	// copy of the XASL of the query
+      XASL_UNPACK_INFO *m_xasl_buf;
+      XASL_NODE *m_block;	// copy of the block being evaluated
+      XASL_STATE m_xasl_state;
+      std::vector<DB_VALUE> m_host_vars;
+  };
+
+  void
+  parallel_aggregation_task::execute (cubthread::entry &thread_ref)
+  {
+    std::size_t index;
+    int error = NO_ERROR;
+
+    /* evaluate in the session of the query thread, e.g. for its time zone */
+    thread_ref.emulate_tid = m_context.m_query_thread_id;
+
+    error = start_block (thread_ref);
+
+    while (error == NO_ERROR && !m_context.m_stop && !thread_ref.shutdown)
+      {
+	index = m_context.m_next_part++;
+	if (index >= m_context.m_parts.size ())
+	  {
+	    break;
+	  }
+
+	error = aggregate_partition (thread_ref, index);
+      }
+
+    if (error != NO_ERROR)
+      {
+	/* the query thread aggregates serially instead and reports the error if there is a real one */
+	er_clear ();
+	m_context.m_has_error = true;
+	m_context.m_stop = true;
+      }
+    if (thread_ref.shutdown)
+      {
+	m_context.m_has_error = true;
+      }
+
+    end_block (thread_ref);
+    thread_ref.emulate_tid = thread_id_t ();
+
+    m_context.notify_task_done ();
+  }
+
+  int
+  parallel_aggregation_task::start_block (cubthread::entry &thread_ref)
+  {
+    THREAD_ENTRY *thread_p = &thread_ref;
+    VAL_DESCR *vd = &m_xasl_state.vd;
+    int position = 0;
+    int i;
+    int error = NO_ERROR;
+
+    error = stx_map_stream_to_xasl (thread_p, &m_xasl, false, m_context.m_xasl_stream, m_context.m_xasl_stream_size,
+				    &m_xasl_buf);
+    if (error != NO_ERROR)
+      {
+	return error;
+      }
+
+    m_block = qexec_find_uncorrelated_block (m_xasl, NULL, m_context.m_block_position, &position);
+    if (m_block == NULL || m_block->type != BUILDVALUE_PROC)
+      {
+	assert (false);
+	return ER_FAILED;
+      }
+
+    /* the host variables are peeked by the evaluation, so every task has its own copies */
+    m_xasl_state = *m_context.m_xasl_state;
+    m_host_vars.resize (vd->dbval_cnt);
+    for (i = 0; i < vd->dbval_cnt; i++)
+      {
+	db_make_null (&m_host_vars[i]);
+	if (pr_clone_value (&vd->dbval_ptr[i], &m_host_vars[i]) != NO_ERROR)
+	  {
+	    return ER_FAILED;
+	  }
+      }
+    vd->dbval_ptr = m_host_vars.data ();
+    vd->xasl_state = &m_xasl_state;
+
+    return NO_ERROR;
+  }
+
+  void
+  parallel_aggregation_task::end_block (cubthread::entry &thread_ref)
+  {
+    THREAD_ENTRY *thread_p = &thread_ref;
+    std::size_t i;
+
+    for (i = 0; i < m_host_vars.size (); i++)
+      {
+	pr_clear_value (&m_host_vars[i]);
+      }
+
+    if (m_xasl != NULL)
+      {
+	(void) qexec_clear_xasl (thread_p, m_xasl, true);
+      }
+    if (m_xasl_buf != NULL)
+      {
+	free_xasl_unpack_info (thread_p, m_xasl_buf);
+      }
+    m_xasl = NULL;
+    m_block = NULL;
+  }
+
+  int
+  parallel_aggregation_task::aggregate_partition (cubthread::entry &thread_ref, std::size_t index)
+  {
+    THREAD_ENTRY *thread_p = &thread_ref;
+    parallel_aggregation::partial_result &result = m_context.m_results[index];
+    OID *class_oid = &m_context.m_parts[index]->oid;
+    HFID *hfid = &m_context.m_parts[index]->hfid;
+    ACCESS_SPEC_TYPE *spec = m_block->spec_list;
+    CLS_SPEC_TYPE *cls_node = &spec->s.cls_node;
+    VAL_DESCR *vd = &m_xasl_state.vd;
+    HEAP_SCANCACHE scan_cache;
+    bool scan_cache_started = false;
+    bool pred_attrs_started = false;
+    bool rest_attrs_started = false;
+    SCAN_PRED scan_pred;
+    SCAN_ATTRS pred_attrs;
+    FILTER_INFO data_filter;
+    DB_TYPE single_node_type = DB_TYPE_NULL;
+    DB_LOGICAL ev_res;
+    AGGREGATE_TYPE *agg_p, *block_agg_p;
+    OID oid;
+    RECDES recdes = RECDES_INITIALIZER;
+    SCAN_CODE scan_code;
+    DB_VALUE *value;
+    std::size_t i;
+    int error = NO_ERROR;
+
+    /* the regu variables keep pointers into the attribute caches of the previous partition */
+    qexec_reset_regu_variable_list (cls_node->cls_regu_list_pred);
+    qexec_reset_regu_variable_list (cls_node->cls_regu_list_rest);
+    qexec_reset_pred_expr (spec->where_pred);
+    qexec_reset_pred_expr (m_block->if_pred);
+    for (block_agg_p = m_block->proc.buildvalue.agg_list; block_agg_p != NULL; block_agg_p = block_agg_p->next)
+      {
+	if (block_agg_p->operands != NULL)
+	  {
+	    qexec_reset_regu_variable (&block_agg_p->operands->value);
+	  }
+      }
+
+    /* no class oid for the scan cache: the partition is locked by the query transaction, not by this worker */
+    error = heap_scancache_start (thread_p, &scan_cache, hfid, NULL, true, m_context.m_snapshot);
+    if (error != NO_ERROR)
+      {
+	goto end;
+      }
+    scan_cache_started = true;
+
+    if (cls_node->num_attrs_pred > 0)
+      {
+	error = heap_attrinfo_start (thread_p, class_oid, cls_node->num_attrs_pred, cls_node->attrids_pred,
+				     cls_node->cache_pred);
+	if (error != NO_ERROR)
+	  {
+	    goto end;
+	  }
+	pred_attrs_started = true;
+      }
+    if (cls_node->num_attrs_rest > 0)
+      {
+	error = heap_attrinfo_start (thread_p, class_oid, cls_node->num_attrs_rest, cls_node->attrids_rest,
+				     cls_node->cache_rest);
+	if (error != NO_ERROR)
+	  {
+	    goto end;
+	  }
+	rest_attrs_started = true;
+      }
+
+    /* the data filter of the heap scan */
+    scan_pred.regu_list = cls_node->cls_regu_list_pred;
+    scan_pred.pred_expr = spec->where_pred;
+    scan_pred.pr_eval_fnc = (spec->where_pred != NULL) ? eval_fnc (thread_p, spec->where_pred, &single_node_type) : NULL;
+    pred_attrs.num_attrs = cls_node->num_attrs_pred;
+    pred_attrs.attr_ids = cls_node->attrids_pred;
+    pred_attrs.attr_cache = pred_attrs_started ? cls_node->cache_pred : NULL;
+    scan_init_filter_info (&data_filter, &scan_pred, &pred_attrs, m_block->val_list, vd, class_oid, 0, NULL, NULL,
+			   NULL);
+
+    OID_SET_NULL (&oid);
+    oid.volid = hfid->vfid.volid;
+
+    while (!m_context.m_stop && !thread_ref.shutdown)
+      {
+	scan_code = heap_next (thread_p, hfid, class_oid, &oid, &recdes, &scan_cache, PEEK);
+	if (scan_code == S_END)
+	  {
+	    break;
+	  }
+	else if (scan_code != S_SUCCESS)
+	  {
+	    error = ER_FAILED;
+	    break;
+	  }
+
+	ev_res = eval_data_filter (thread_p, &oid, &recdes, &scan_cache, &data_filter);
+	if (ev_res == V_ERROR)
+	  {
+	    error = ER_FAILED;
+	    break;
+	  }
+	else if (ev_res != V_TRUE)
+	  {
+	    continue;
+	  }
+
+	if (cls_node->cls_regu_list_rest != NULL)
+	  {
+	    if (rest_attrs_started)
+	      {
+		error = heap_attrinfo_read_dbvalues (thread_p, &oid, &recdes, cls_node->cache_rest);
+		if (error != NO_ERROR)
+		  {
+		    break;
+		  }
+	      }
+	    error = fetch_val_list (thread_p, cls_node->cls_regu_list_rest, vd, class_oid, &oid, NULL, PEEK);
+	    if (error != NO_ERROR)
+	      {
+		break;
+	      }
+	  }
+
+	if (m_block->if_pred != NULL)
+	  {
+	    ev_res = eval_pred (thread_p, m_block->if_pred, vd, NULL);
+	    if (ev_res == V_ERROR)
+	      {
+		error = ER_FAILED;
+		break;
+	      }
+	    else if (ev_res != V_TRUE)
+	      {
+		continue;
+	      }
+	  }
+
+	for (agg_p = m_context.m_agg_list, block_agg_p = m_block->proc.buildvalue.agg_list, i = 0;
+	     agg_p != NULL && block_agg_p != NULL; agg_p = agg_p->next, block_agg_p = block_agg_p->next, i++)
+	  {
+	    if (agg_p->flag_agg_optimize)
+	      {
+		continue;
+	      }
+
+	    value = NULL;
+	    if (agg_p->function != PT_COUNT_STAR)
+	      {
+		error = fetch_peek_dbval (thread_p, &block_agg_p->operands->value, vd, class_oid, &oid, NULL, &value);
+		if (error != NO_ERROR)
+		  {
+		    break;
+		  }
+	      }
+
+	    error = qdata_aggregate_value_to_partial_accumulator (thread_p, agg_p, &result.accumulators[i], value);
+	    if (error != NO_ERROR)
+	      {
+		break;
+	      }
+	  }
+	if (error != NO_ERROR)
+	  {
+	    break;
+	  }
+      }
+
+  end:
+    if (rest_attrs_started)
+      {
+	heap_attrinfo_end (thread_p, cls_node->cache_rest);
+      }
+    if (pred_attrs_started)
+      {
+	heap_attrinfo_end (thread_p, cls_node->cache_pred);
+      }
+    if (scan_cache_started)
+      {
+	(void) heap_scancache_end (thread_p, &scan_cache);
+      }
+
+    return error;
+  }
+}
+// *INDENT-ON*
+
+/*
+ * qexec_find_uncorrelated_block () - find a block that is executed independently of the other blocks
+ * return : the block, or NULL if it is not found
+ * xasl (in)	     : first block of a list, the root block or an aptr_list
+ * block (in)	     : block to find, or NULL to find the block at the target position
+ * target (in)	     : position of the block to find when block is NULL, -1 otherwise
+ * position (in/out) : position of the next block of the walk
+ *
+ * Note: Only the root block and the uncorrelated subqueries are walked. A block found by this walk does not depend on
+ *	 values computed by other blocks except its own aptr_list, and the walk finds the same position in every copy
+ *	 of the XASL unpacked from the same stream.
+ */
+static XASL_NODE *
+qexec_find_uncorrelated_block (XASL_NODE * xasl, XASL_NODE * block, int target, int *position)
+{
+  XASL_NODE *found;
+
+  for (; xasl != NULL; xasl = xasl->next)
+    {
+      if (xasl == block || *position == target)
+	{
+	  return xasl;
+	}
+      (*position)++;
+
+      found = qexec_find_uncorrelated_block (xasl->aptr_list, block, target, position);
+      if (found != NULL)
+	{
+	  return found;
+	}
+    }
+
+  return NULL;
+}
+
+/*
+ * qexec_is_regu_worker_safe () - can a regu variable be evaluated by a task of the shared worker pool?
+ * return : true if it can
+ * regu (in) : regu variable
+ *
+ * Note: A worker does not belong to the transaction and the session of the query, and it evaluates a copy of a single
+ *	 block. Values of list files and other blocks, serials, session variables and transaction information are not
+ *	 available to it.
+ */
+static bool
+qexec_is_regu_worker_safe (REGU_VARIABLE * regu)
+{
+  REGU_VARIABLE_LIST regu_p;
+
+  if (regu == NULL)
+    {
+      return true;
+    }
+
+  if (regu->xasl != NULL)
+    {
+      return false;
+    }
+
+  switch (regu->type)
+    {
+    case TYPE_DBVAL:
+    case TYPE_CONSTANT:
+    case TYPE_POS_VALUE:
+    case TYPE_ATTR_ID:
+    case TYPE_SHARED_ATTR_ID:
+    case TYPE_OID:
+    case TYPE_CLASSOID:
+      return true;
+
+    case TYPE_INARITH:
+    case TYPE_OUTARITH:
+      switch (regu->value.arithptr->opcode)
+	{
+	case T_NEXT_VALUE:
+	case T_CURRENT_VALUE:
+	case T_ROW_COUNT:
+	case T_LAST_INSERT_ID:
+	case T_EVALUATE_VARIABLE:
+	case T_DEFINE_VARIABLE:
+	case T_LOCAL_TRANSACTION_ID:
+	case T_EXEC_STATS:
+	case T_TRACE_STATS:
+	case T_RAND:
+	case T_RANDOM:
+	case T_DRAND:
+	case T_DRANDOM:
+	  return false;
+
+	default:
+	  break;
+	}
+      return (qexec_is_regu_worker_safe (regu->value.arithptr->leftptr)
+	      && qexec_is_regu_worker_safe (regu->value.arithptr->rightptr)
+	      && qexec_is_regu_worker_safe (regu->value.arithptr->thirdptr)
+	      && qexec_is_pred_worker_safe (regu->value.arithptr->pred));
+
+    case TYPE_FUNC:
+      for (regu_p = regu->value.funcp->operand; regu_p != NULL; regu_p = regu_p->next)
+	{
+	  if (!qexec_is_regu_worker_safe (&regu_p->value))
+	    {
+	      return false;
+	    }
+	}
+      return true;
+
+    default:
+      return false;
+    }
+}
+
+/*
+ * qexec_is_regu_list_worker_safe () - can a regu variable list be evaluated by a task of the shared worker pool?
+ * return : true if it can
+ * list (in) : regu variable list
+ */
+static bool
+qexec_is_regu_list_worker_safe (REGU_VARIABLE_LIST list)
+{
+  REGU_VARIABLE_LIST regu_p;
+
+  for (regu_p = list; regu_p != NULL; regu_p = regu_p->next)
+    {
+      if (!qexec_is_regu_worker_safe (&regu_p->value))
+	{
+	  return false;
+	}
+    }
+
+  return true;
+}
+
+/*
+ * qexec_is_pred_worker_safe () - can a predicate be evaluated by a task of the shared worker pool?
+ * return : true if it can
+ * pred (in) : predicate
+ */
+static bool
+qexec_is_pred_worker_safe (PRED_EXPR * pred)
+{
+  if (pred == NULL)
+    {
+      return true;
+    }
+
+  switch (pred->type)
+    {
+    case T_PRED:
+      return qexec_is_pred_worker_safe (pred->pe.m_pred.lhs) && qexec_is_pred_worker_safe (pred->pe.m_pred.rhs);
+
+    case T_EVAL_TERM:
+      switch (pred->pe.m_eval_term.et_type)
+	{
+	case T_COMP_EVAL_TERM:
+	  return (qexec_is_regu_worker_safe (pred->pe.m_eval_term.et.et_comp.lhs)
+		  && qexec_is_regu_worker_safe (pred->pe.m_eval_term.et.et_comp.rhs));
+
+	case T_ALSM_EVAL_TERM:
+	  return (qexec_is_regu_worker_safe (pred->pe.m_eval_term.et.et_alsm.elem)
+		  && qexec_is_regu_worker_safe (pred->pe.m_eval_term.et.et_alsm.elemset));
+
+	case T_LIKE_EVAL_TERM:
+	  return (qexec_is_regu_worker_safe (pred->pe.m_eval_term.et.et_like.src)
+		  && qexec_is_regu_worker_safe (pred->pe.m_eval_term.et.et_like.pattern)
+		  && qexec_is_regu_worker_safe (pred->pe.m_eval_term.et.et_like.esc_char));
+
+	case T_RLIKE_EVAL_TERM:
+	  return (qexec_is_regu_worker_safe (pred->pe.m_eval_term.et.et_rlike.src)
+		  && qexec_is_regu_worker_safe (pred->pe.m_eval_term.et.et_rlike.pattern)
+		  && qexec_is_regu_worker_safe (pred->pe.m_eval_term.et.et_rlike.case_sensitive));
+
+	default:
+	  return false;
+	}
+
+    case T_NOT_TERM:
+      return qexec_is_pred_worker_safe (pred->pe.m_not_term);
+
+    default:
+      return false;
+    }
+}
+
+/*
+ * qexec_is_parallel_aggregation_eligible () - can the aggregates of the block be computed per partition?
+ * return : true if eligible
+ * xasl (in) : BUILDVALUE_PROC block
+ *
+ * Note: Only a sequential scan of a single partitioned class qualifies: no joins or subqueries, and a select list made
+ *	 only of aggregates, since nothing but the accumulators is computed. The data filter, the if predicate and the
+ *	 operands are evaluated by the workers, so they must not need anything a worker does not have, see
+ *	 qexec_is_regu_worker_safe.
+ */
+static bool
+qexec_is_parallel_aggregation_eligible (XASL_NODE * xasl)
+{
+  BUILDVALUE_PROC_NODE *buildvalue = &xasl->proc.buildvalue;
+  ACCESS_SPEC_TYPE *spec = xasl->spec_list;
+  AGGREGATE_TYPE *agg_p;
+  REGU_VARIABLE_LIST out_p;
+  REGU_VARIABLE *operand;
+
+  if (xasl->type != BUILDVALUE_PROC || buildvalue->agg_list == NULL || buildvalue->having_pred != NULL
+      || buildvalue->outarith_list != NULL)
+    {
+      return false;
+    }
+
+  if (xasl->aptr_list != NULL || xasl->scan_ptr != NULL || xasl->dptr_list != NULL || xasl->fptr_list != NULL
+      || xasl->bptr_list != NULL || xasl->connect_by_ptr != NULL || xasl->after_join_pred != NULL
+      || xasl->instnum_pred != NULL || XASL_IS_FLAGED (xasl, XASL_SAMPLING_SCAN))
+    {
+      return false;
+    }
+
+  if (spec == NULL || spec->next != NULL || spec->type != TARGET_CLASS || spec->access != ACCESS_METHOD_SEQUENTIAL
+      || spec->parts == NULL)
+    {
+      return false;
+    }
+
+  /* key filters belong to index scans */
+  if (spec->where_key != NULL || spec->where_range != NULL)
+    {
+      return false;
+    }
+
+  if (!qexec_is_pred_worker_safe (spec->where_pred) || !qexec_is_pred_worker_safe (xasl->if_pred)
+      || !qexec_is_regu_list_worker_safe (spec->s.cls_node.cls_regu_list_pred)
+      || !qexec_is_regu_list_worker_safe (spec->s.cls_node.cls_regu_list_rest))
+    {
+      return false;
+    }
+
+  if (spec->s_id.scan_op_type != S_SELECT || spec->s_id.mvcc_select_lock_needed
+      || (spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE))
+    {
+      return false;
+    }
+
+  for (agg_p = buildvalue->agg_list; agg_p != NULL; agg_p = agg_p->next)
+    {
+      if (agg_p->flag_agg_optimize)
+	{
+	  /* already evaluated */
+	  continue;
+	}
+
+      if (!qdata_is_partial_aggregate_supported (agg_p))
+	{
+	  return false;
+	}
+
+      if (agg_p->function == PT_COUNT_STAR)
+	{
+	  continue;
+	}
+
+      operand = &agg_p->operands->value;
+      if (!qexec_is_regu_worker_safe (operand))
+	{
+	  return false;
+	}
+
+      if ((agg_p->function == PT_SUM || agg_p->function == PT_AVG) && agg_p->opr_dbtype == DB_TYPE_NUMERIC
+	  && (operand->domain == NULL || TP_DOMAIN_TYPE (operand->domain) != DB_TYPE_NUMERIC))
+	{
+	  /* the scale of the operand is needed to resolve the accumulator domain */
+	  return false;
+	}
+    }
+
+  for (out_p = xasl->outptr_list->valptrp; out_p != NULL; out_p = out_p->next)
+    {
+      if (out_p->value.type != TYPE_CONSTANT)
+	{
+	  return false;
+	}
+
+      for (agg_p = buildvalue->agg_list; agg_p != NULL; agg_p = agg_p->next)
+	{
+	  if (agg_p->accumulator.value == out_p->value.value.dbvalptr)
+	    {
+	      break;
+	    }
+	}
+      if (agg_p == NULL)
+	{
+	  /* not an aggregate result */
+	  return false;
+	}
+    }
+
+  return true;
+}
+
+/*
+ * qexec_evaluate_aggregates_parallel () - compute the aggregates of a partitioned class scan with several threads
+ * return : error code or NO_ERROR
+ * thread_p (in)      :
+ * xasl (in)	      : BUILDVALUE_PROC block with opened scans
+ * xasl_state (in)    : XASL state of the query
+ * is_evaluated (out) : true if the aggregates were computed and the scan is no longer needed
+ *
+ * Note: The pruned partitions are scanned by up to parallel_aggregation_threads tasks of the shared worker pool,
+ *	 which keep partial accumulators per partition; they are combined into the accumulators of the aggregate list
+ *	 at the end. The workers do not use the transaction of the query: the query thread locks the partitions and
+ *	 hands them its snapshot, and only a transaction that has not modified anything qualifies, since a worker could
+ *	 not see the changes of the transaction.
+ *	 Every task unpacks a copy of the XASL from the XASL cache entry of the query to evaluate the predicates, so
+ *	 only the root block and uncorrelated subqueries of a cached query qualify.
+ *	 If the block does not qualify, there is no worker pool or a worker fails, nothing is changed and the
+ *	 aggregates are evaluated by the regular scan.
+ */
+static int
+qexec_evaluate_aggregates_parallel (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
+				    bool * is_evaluated)
+{
+  BUILDVALUE_PROC_NODE *buildvalue = &xasl->proc.buildvalue;
+  ACCESS_SPEC_TYPE *spec = xasl->spec_list;
+  cubquery::parallel_aggregation *context = NULL;
+  cubthread::entry_workpool *workpool = NULL;
+  QMGR_QUERY_ENTRY *query_p;
+  PARTITION_SPEC_TYPE *part;
+  AGGREGATE_TYPE *agg_p;
+  REGU_VARIABLE *operand;
+  std::vector<bool> domain_resolved;
+  std::size_t agg_count, part_count, task_count, i, j;
+  int thread_count;
+  int block_position = 0;
+  bool dummy_continue_checking = true;
+  int error = NO_ERROR;
+
+  *is_evaluated = false;
+
+  thread_count = prm_get_integer_value (PRM_ID_PARALLEL_AGGREGATION_THREADS);
+  if (thread_count <= 0 || !qexec_is_parallel_aggregation_eligible (xasl))
+    {
+      return NO_ERROR;
+    }
+
+  if (logtb_find_current_mvccid (thread_p) != MVCCID_NULL)
+    {
+      /* the workers would not see what the transaction changed */
+      return NO_ERROR;
+    }
+
+  part_count = 0;
+  for (part = spec->parts; part != NULL; part = part->next)
+    {
+      part_count++;
+    }
+  if (part_count < 2)
+    {
+      return NO_ERROR;
+    }
+
+  /* the workers unpack their copies of the block from the stream of the XASL cache entry */
+  if (qexec_find_uncorrelated_block (xasl_state->root_xasl, xasl, -1, &block_position) == NULL)
+    {
+      return NO_ERROR;
+    }
+  query_p = qmgr_get_query_entry (thread_p, xasl_state->query_id, LOG_FIND_THREAD_TRAN_INDEX (thread_p));
+  if (query_p == NULL || query_p->xasl_ent == NULL || query_p->xasl_ent->stream.buffer == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  workpool = qexec_get_worker_pool ();
+  if (workpool == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  context = new cubquery::parallel_aggregation ();
+  context->m_agg_list = buildvalue->agg_list;
+  context->m_xasl_stream = query_p->xasl_ent->stream.buffer;
+  context->m_xasl_stream_size = query_p->xasl_ent->stream.buffer_size;
+  context->m_block_position = block_position;
+  context->m_xasl_state = xasl_state;
+  context->m_query_thread_id = thread_p->get_id ();
+  context->m_snapshot = logtb_get_mvcc_snapshot (thread_p);
+  if (context->m_snapshot == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      goto end;
+    }
+
+  /* lock the partitions for the transaction, as the scan of each partition would */
+  for (part = spec->parts; part != NULL; part = part->next)
+    {
+      if (lock_scan (thread_p, &part->oid, LK_UNCOND_LOCK, IS_LOCK) != LK_GRANTED)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  goto end;
+	}
+      context->m_parts.push_back (part);
+    }
+
+  /* accumulator domains, which are otherwise resolved with the first row */
+  agg_count = 0;
+  for (agg_p = buildvalue->agg_list; agg_p != NULL; agg_p = agg_p->next)
+    {
+      agg_count++;
+
+      if (agg_p->flag_agg_optimize
+	  || (agg_p->accumulator_domain.value_dom != NULL && agg_p->accumulator_domain.value2_dom != NULL))
+	{
+	  domain_resolved.push_back (false);
+	  continue;
+	}
+
+      switch (agg_p->function)
+	{
+	case PT_COUNT_STAR:
+	case PT_COUNT:
+	  agg_p->accumulator_domain.value_dom = &tp_Bigint_domain;
+	  agg_p->accumulator_domain.value2_dom = &tp_Null_domain;
+	  break;
+
+	case PT_MIN:
+	case PT_MAX:
+	  agg_p->accumulator_domain.value_dom = agg_p->domain;
+	  agg_p->accumulator_domain.value2_dom = &tp_Null_domain;
+	  break;
+
+	case PT_SUM:
+	case PT_AVG:
+	  operand = &agg_p->operands->value;
+	  qexec_resolve_sum_accumulator_domain (agg_p, agg_p->opr_dbtype,
+						operand->domain != NULL ? operand->domain->scale : 0);
+	  break;
+
+	default:
+	  assert (false);
+	  break;
+	}
+      domain_resolved.push_back (true);
+    }
+
+  context->m_results.resize (part_count);
+  for (i = 0; i < part_count; i++)
+    {
+      cubquery::parallel_aggregation::partial_result & result = context->m_results[i];
+
+      result.values.resize (2 * agg_count);
+      result.accumulators.resize (agg_count);
+      for (j = 0; j < agg_count; j++)
+	{
+	  db_make_null (&result.values[2 * j]);
+	  db_make_null (&result.values[2 * j + 1]);
+	  result.accumulators[j].value = &result.values[2 * j];
+	  result.accumulators[j].value2 = &result.values[2 * j + 1];
+	  result.accumulators[j].curr_cnt = 0;
+	  result.accumulators[j].clear_value_at_clone_decache = false;
+	  result.accumulators[j].clear_value2_at_clone_decache = false;
+	}
+    }
+
+  task_count = MIN ((std::size_t) thread_count, part_count);
+  for (i = 0; i < task_count; i++)
+    {
+      thread_get_manager ()->push_task (workpool, new cubquery::parallel_aggregation_task (*context));
+    }
+
+  /* wait for the tasks, which all must be done before the context is freed; stop them on interrupt */
+  {
+    // *INDENT-OFF*
+    std::unique_lock<std::mutex> lock (context->m_mutex);
+
+    while (context->m_tasks_done < task_count)
+      {
+	if (context->m_cond.wait_for (lock, std::chrono::milliseconds (100)) == std::cv_status::timeout
+	    && error == NO_ERROR && logtb_is_interrupted (thread_p, true, &dummy_continue_checking))
+	  {
+	    er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERRUPTED, 0);
+	    error = ER_INTERRUPTED;
+	    context->m_stop = true;
+	  }
+      }
+    // *INDENT-ON*
+  }
+
+  if (error != NO_ERROR || context->m_has_error)
+    {
+      goto end;
+    }
+
+  for (i = 0; i < part_count && error == NO_ERROR; i++)
+    {
+      for (agg_p = buildvalue->agg_list, j = 0; agg_p != NULL; agg_p = agg_p->next, j++)
+	{
+	  if (agg_p->flag_agg_optimize)
+	    {
+	      continue;
+	    }
+
+	  error = qdata_combine_partial_accumulator (thread_p, agg_p, &context->m_results[i].accumulators[j]);
+	  if (error != NO_ERROR)
+	    {
+	      break;
+	    }
+	}
+    }
+
+  if (error == NO_ERROR)
+    {
+      *is_evaluated = true;
+      spec->s_id.scan_stats.noscan = false;
+    }
+
+end:
+  if (!*is_evaluated)
+    {
+      /* let the regular scan resolve the domains from the rows */
+      for (agg_p = buildvalue->agg_list, j = 0; agg_p != NULL && j < domain_resolved.size ();
+	   agg_p = agg_p->next, j++)
+	{
+	  if (domain_resolved[j])
+	    {
+	      agg_p->accumulator_domain.value_dom = NULL;
+	      agg_p->accumulator_domain.value2_dom = NULL;
+	    }
+	}
+    }
+
+  for (i = 0; i < context->m_results.size (); i++)
+    {
+      for (j = 0; j < context->m_results[i].values.size (); j++)
+	{
+	  pr_clear_value (&context->m_results[i].values[j]);
+	}
+    }
+  delete context;
+
+  return error;
+}
+
 /*
  * qexec_setup_topn_proc () - setup a top-n object
  * return : error code or NO_ERROR
@@ -91,6 +91,7 @@ extern void get_xasl_dumper_linked_in ();
 #endif
 
 extern int qexec_clear_list_cache_by_class (THREAD_ENTRY * thread_p, const OID * class_oid);
+extern void qexec_finalize_worker_pool (void);
 
 #if defined(CUBRID_DEBUG)
 extern bool qdump_check_xasl_tree (xasl_node * xasl);
@@ -46,6 +46,9 @@ typedef enum
 /* aligned size of the field */
 #define QFILE_PAGE_HEADER_SIZE          32
 
+/* most list file pages sent to the client in one reply */
+#define QFILE_MAX_LIST_FILE_PAGE_FETCH_SIZE  (16 * IO_MAX_PAGE_SIZE)
+
 /* offset values to access fields */
 #define QFILE_TUPLE_COUNT_OFFSET        0
 #define QFILE_PREV_PAGE_ID_OFFSET       4
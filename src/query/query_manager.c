@@ -931,6 +931,7 @@ qmgr_finalize (THREAD_ENTRY * thread_p)
 
   scan_finalize ();
   qfile_finalize ();
+  qexec_finalize_worker_pool ();
 
   if (csect_enter (thread_p, CSECT_QPROC_QUERY_TABLE, INF_WAIT) != NO_ERROR)
     {
@@ -165,6 +165,7 @@ static int scan_dbvals_to_midxkey (THREAD_ENTRY * thread_p, DB_VALUE * retval, b
 				   int key_minmax, bool is_iss);
 static int scan_regu_key_to_index_key (THREAD_ENTRY * thread_p, KEY_RANGE * key_ranges, KEY_VAL_RANGE * key_val_range,
 				       INDX_SCAN_ID * iscan_id, TP_DOMAIN * btree_domainp, VAL_DESCR * vd);
+static void scan_prefetch_index_heap_pages (THREAD_ENTRY * thread_p, INDX_SCAN_ID * iscan_id);
 static int scan_get_index_oidset (THREAD_ENTRY * thread_p, SCAN_ID * s_id, DB_BIGINT * key_limit_upper,
 				  DB_BIGINT * key_limit_lower);
 static void scan_init_scan_id (SCAN_ID * scan_id, bool force_select_lock, SCAN_OPERATION_TYPE scan_op_type, int fixed,
@@ -182,6 +183,7 @@ static SCAN_CODE scan_next_index_node_info_scan (THREAD_ENTRY * thread_p, SCAN_I
 static SCAN_CODE scan_next_index_lookup_heap (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, INDX_SCAN_ID * isidp,
 					      FILTER_INFO * data_filter, TRAN_ISOLATION isolation);
 static SCAN_CODE scan_next_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
+static SCAN_CODE scan_next_list_tuple (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, QFILE_TUPLE_RECORD * tplrec);
 static SCAN_CODE scan_next_showstmt_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_set_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_json_table_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
@@ -2188,6 +2190,60 @@ scan_regu_key_to_index_key (THREAD_ENTRY * thread_p, KEY_RANGE * key_ranges, KEY
   return ret;
 }
 
+/*
+ * scan_prefetch_index_heap_pages () - Read the heap pages of the current OID set in VPID order.
+ *   return: nothing
+ *   iscan_id(in): Index scan identifier
+ *
+ * Note: The OID set collected from the index is in key order, which for a non-clustered index translates into
+ *       random heap page reads. The distinct heap pages are sorted by VPID and fixed once each, so that the
+ *       following fetches, done in the original index order, find the pages in the page buffer. The OID set
+ *       itself is left untouched, so the order of the scan results does not change.
+ *       This is only a hint; any failure is ignored and the pages are read again on demand.
+ */
+static void
+scan_prefetch_index_heap_pages (THREAD_ENTRY * thread_p, INDX_SCAN_ID * iscan_id)
+{
+  VPID *vpids;
+  VPID prev_vpid;
+  PAGE_PTR pgptr;
+  int i;
+
+  vpids = (VPID *) db_private_alloc (thread_p, iscan_id->oids_count * sizeof (VPID));
+  if (vpids == NULL)
+    {
+      er_clear ();
+      return;
+    }
+
+  for (i = 0; i < iscan_id->oids_count; i++)
+    {
+      VPID_GET_FROM_OID (&vpids[i], &iscan_id->oid_list->oidp[i]);
+    }
+  qsort (vpids, iscan_id->oids_count, sizeof (VPID), pgbuf_compare_vpid);
+
+  VPID_SET_NULL (&prev_vpid);
+  for (i = 0; i < iscan_id->oids_count; i++)
+    {
+      if (VPID_EQ (&vpids[i], &prev_vpid))
+	{
+	  continue;
+	}
+      prev_vpid = vpids[i];
+
+      pgptr = pgbuf_fix (thread_p, &vpids[i], OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_READ, PGBUF_CONDITIONAL_LATCH);
+      if (pgptr == NULL)
+	{
+	  /* page is latched by someone else or is gone; the heap fetch will deal with it */
+	  er_clear ();
+	  continue;
+	}
+      pgbuf_unfix_and_init (thread_p, pgptr);
+    }
+
+  db_private_free_and_init (thread_p, vpids);
+}
+
 /*
  * scan_get_index_oidset () - Fetch the next group of set of object identifiers
  * from the index associated with the scan identifier.
@@ -2698,6 +2754,13 @@ scan_get_index_oidset (THREAD_ENTRY * thread_p, SCAN_ID * s_id, DB_BIGINT * key_
     {
       qsort (iscan_id->oid_list->oidp, iscan_id->oids_count, sizeof (OID), oid_compare);
     }
+  else if (iscan_id->oid_list != NULL && iscan_id->oid_list->oidp != NULL && iscan_id->oids_count > 1
+	   && iscan_id->need_count_only == false && !SCAN_IS_INDEX_COVERED (iscan_id)
+	   && !SCAN_IS_INDEX_MRO (iscan_id) && prm_get_bool_value (PRM_ID_BT_INDEX_SCAN_HEAP_PREFETCH))
+    {
+      /* OIDs must be returned in index order, but heap pages can still be read in physical order. */
+      scan_prefetch_index_heap_pages (thread_p, iscan_id);
+    }
 
 end:
 
@@ -3696,6 +3759,12 @@ scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   /* regulator variable list for other than predicates */
   llsidp->rest_regu_list = regu_list_rest;
 
+  /* the list file is read unless a pipe is attached */
+  llsidp->pipe.next_fnc = NULL;
+  llsidp->pipe.close_fnc = NULL;
+  llsidp->pipe.arg = NULL;
+  llsidp->pipe.domains_resolved = false;
+
   /* init for hash list scan */
   /* regulator variable list for build, probe */
   llsidp->hlsid.build_regu_list = regu_list_build;
@@ -3782,6 +3851,35 @@ scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   return NO_ERROR;
 }
 
+/*
+ * scan_attach_list_pipe () - Feed an opened list scan from a tuple producer instead of its list file.
+ *   return:
+ *   scan_id(in/out): Scan identifier of an opened list scan
+ *   next_fnc(in): function returning the next tuple
+ *   close_fnc(in): function releasing the producer; called when the scan is closed
+ *   arg(in): producer context
+ *
+ * Note: The list file of the scan is still opened and closed as usual, but it is expected to stay empty; every tuple
+ *       comes from next_fnc in the layout described by the list file type list.
+ */
+void
+scan_attach_list_pipe (SCAN_ID * scan_id, LIST_PIPE_NEXT_FUNC next_fnc, LIST_PIPE_CLOSE_FUNC close_fnc, void *arg)
+{
+  LLIST_SCAN_ID *llsidp;
+
+  assert (scan_id->type == S_LIST_SCAN);
+
+  llsidp = &scan_id->s.llsid;
+
+  /* hash list scan is never chosen for a list that is empty when the scan is opened */
+  assert (llsidp->hlsid.hash_list_scan_type == HASH_METH_NOT_USE);
+
+  llsidp->pipe.next_fnc = next_fnc;
+  llsidp->pipe.close_fnc = close_fnc;
+  llsidp->pipe.arg = arg;
+  llsidp->pipe.domains_resolved = false;
+}
+
 /*
  * scan_open_showstmt_scan () -
  *   return: NO_ERROR
@@ -4473,6 +4571,9 @@ scan_reset_scan_block (THREAD_ENTRY * thread_p, SCAN_ID * s_id)
       break;
 
     case S_LIST_SCAN:
+      /* the tuples pulled from a producer cannot be read again */
+      assert (s_id->s.llsid.pipe.next_fnc == NULL);
+
       /* may have scanned some already so clean up */
       qfile_end_scan_fix (thread_p, &s_id->s.llsid.lsid);
       qfile_close_scan (thread_p, &s_id->s.llsid.lsid);
@@ -4912,6 +5013,14 @@ scan_close_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 
     case S_LIST_SCAN:
       llsidp = &scan_id->s.llsid;
+      /* release the producer of a pipelined list scan */
+      if (llsidp->pipe.close_fnc != NULL)
+	{
+	  (*llsidp->pipe.close_fnc) (thread_p, llsidp->pipe.arg);
+	}
+      llsidp->pipe.next_fnc = NULL;
+      llsidp->pipe.close_fnc = NULL;
+      llsidp->pipe.arg = NULL;
       /* clear hash list scan table */
       if (llsidp->hlsid.hash_list_scan_type == HASH_METH_IN_MEM
 	  || llsidp->hlsid.hash_list_scan_type == HASH_METH_HYBRID)
@@ -6448,6 +6557,36 @@ scan_next_index_node_info_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
     }
 }
 
+/*
+ * scan_next_list_tuple () - Get the next tuple of a list scan.
+ *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
+ *   scan_id(in/out): Scan identifier
+ *   tplrec(out): Tuple record; the tuple is peeked
+ *
+ * Note: A pipelined list scan pulls the tuple from its producer. The domains of the list type list are only known
+ *       after the producer generated its first tuples, so the scan regu variables are resolved here.
+ */
+static SCAN_CODE
+scan_next_list_tuple (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, QFILE_TUPLE_RECORD * tplrec)
+{
+  LLIST_SCAN_ID *llsidp = &scan_id->s.llsid;
+  SCAN_CODE qp_scan;
+
+  if (llsidp->pipe.next_fnc == NULL)
+    {
+      return qfile_scan_list_next (thread_p, &llsidp->lsid, tplrec, PEEK);
+    }
+
+  qp_scan = (*llsidp->pipe.next_fnc) (thread_p, llsidp->pipe.arg, tplrec);
+  if (qp_scan == S_SUCCESS && !llsidp->pipe.domains_resolved)
+    {
+      resolve_domains_on_list_scan (llsidp, scan_id->val_list);
+      llsidp->pipe.domains_resolved = llsidp->list_id->is_domain_resolved;
+    }
+
+  return qp_scan;
+}
+
 /*
  * scan_next_list_scan () - The scan is moved to the next list scan item.
  *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
@@ -6468,9 +6607,12 @@ scan_next_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
   tplrec.size = 0;
   tplrec.tpl = (QFILE_TUPLE) NULL;
 
-  resolve_domains_on_list_scan (llsidp, scan_id->val_list);
+  if (llsidp->pipe.next_fnc == NULL)
+    {
+      resolve_domains_on_list_scan (llsidp, scan_id->val_list);
+    }
 
-  while ((qp_scan = qfile_scan_list_next (thread_p, &llsidp->lsid, &tplrec, PEEK)) == S_SUCCESS)
+  while ((qp_scan = scan_next_list_tuple (thread_p, scan_id, &tplrec)) == S_SUCCESS)
     {
 
       /* fetch the values for the predicate from the tuple */
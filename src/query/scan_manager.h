@@ -253,6 +253,19 @@ struct index_node_scan_id
   regu_variable_list_node *node_info_regu_list;	/* regulator variable list */
 };
 
+/* producer of tuples for a list scan whose list file is not materialized (pipelined subquery) */
+typedef SCAN_CODE (*LIST_PIPE_NEXT_FUNC) (THREAD_ENTRY * thread_p, void *arg, QFILE_TUPLE_RECORD * tplrec);
+typedef void (*LIST_PIPE_CLOSE_FUNC) (THREAD_ENTRY * thread_p, void *arg);
+
+typedef struct list_pipe LIST_PIPE;
+struct list_pipe
+{
+  LIST_PIPE_NEXT_FUNC next_fnc;	/* returns the next tuple instead of the list file */
+  LIST_PIPE_CLOSE_FUNC close_fnc;	/* releases the producer when the scan is closed */
+  void *arg;			/* producer context */
+  bool domains_resolved;	/* scan regu domains were resolved against the list type list */
+};
+
 typedef struct llist_scan_id LLIST_SCAN_ID;
 struct llist_scan_id
 {
@@ -262,6 +275,7 @@ struct llist_scan_id
   regu_variable_list_node *rest_regu_list;	/* regulator variable list */
   QFILE_TUPLE_RECORD *tplrecp;	/* tuple record pointer; output param */
   HASH_LIST_SCAN hlsid;		/* for hash scan */
+  LIST_PIPE pipe;		/* for pipelined list scan */
 };
 
 typedef struct showstmt_scan_id SHOWSTMT_SCAN_ID;
@@ -481,6 +495,8 @@ extern int scan_open_dblink_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
 				  struct access_spec_node *spec,
 				  VAL_DESCR * vd, val_list_node * val_list, DBLINK_HOST_VARS * host_vars);
 
+extern void scan_attach_list_pipe (SCAN_ID * scan_id, LIST_PIPE_NEXT_FUNC next_fnc, LIST_PIPE_CLOSE_FUNC close_fnc,
+				   void *arg);
 extern int scan_start_scan (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
 extern SCAN_CODE scan_reset_scan_block (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
 extern SCAN_CODE scan_next_scan_block (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
@@ -55,6 +55,7 @@
 #include "util_func.h"
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <stack>
@@ -468,6 +469,8 @@ lockfree::circular_queue<vacuum_data_entry> *vacuum_Block_data_buffer = NULL;
  */
 /* *INDENT-OFF* */
 lockfree::circular_queue<VACUUM_LOG_BLOCKID> *vacuum_Finished_job_queue = NULL;
+/* Jobs dispatched to vacuum workers and not yet finished. */
+static std::atomic<int> vacuum_Worker_job_count { 0 };
 /* *INDENT-ON* */
 
 /* number or log pages on each block of buffer log prefetch */
@@ -475,6 +478,11 @@ lockfree::circular_queue<VACUUM_LOG_BLOCKID> *vacuum_Finished_job_queue = NULL;
 
 #if defined(SERVER_MODE)
 #define VACUUM_MAX_TASKS_IN_WORKER_POOL ((size_t) (3 * prm_get_integer_value (PRM_ID_VACUUM_WORKER_COUNT)))
+
+/* adaptive worker control: backlog of log blocks each active worker is expected to handle before one more is added */
+#define VACUUM_BACKLOG_BLOCKS_PER_WORKER 4
+/* backlog of log blocks per configured worker from which vacuum keeps half of the workers even under I/O stress */
+#define VACUUM_CRITICAL_BACKLOG_BLOCKS_PER_WORKER 64
 #endif /* SERVER_MODE */
 
 #define VACUUM_FINISHED_JOB_QUEUE_CAPACITY  2048
@@ -815,14 +823,21 @@ class vacuum_master_task : public cubthread::entry_task
   private:
     bool check_shutdown () const;
     bool is_task_queue_full () const;
-    bool should_interrupt_iteration () const;         // conditions to interrupt an iteration and go to sleep
+    bool is_worker_limit_reached () const;
+    bool is_io_budget_exhausted ();
+    bool should_interrupt_iteration ();               // conditions to interrupt an iteration and go to sleep
     bool is_cursor_entry_ready_to_vacuum () const;    // check if conditions to vacuum cursor entry are met
     bool is_cursor_entry_available () const;          // check if cursor entry is available and can generate a new job
-    void start_job_on_cursor_entry () const;          // start job on cursor entry
+    void start_job_on_cursor_entry ();                // start job on cursor entry
     bool should_force_data_update () const;           // conditions to force a vacuum data update
+    void adapt_worker_limit (cubthread::entry &thread_ref);  // scale active workers to backlog and I/O pressure
 
     vacuum_job_cursor m_cursor;                       // cursor that iterates through vacuum data entries
     MVCCID m_oldest_visible_mvccid;                   // saved oldest visible mvccid (recomputed on each iteration)
+
+    int m_worker_limit = 0;                           // jobs that may run or wait at once; 0 if not yet computed
+    std::chrono::steady_clock::time_point m_io_budget_start;  // start of current I/O budget second
+    int m_io_budget_blocks = 0;                       // blocks dispatched in current I/O budget second
 };
 
 // class vacuum_worker_context_manager
@@ -916,6 +931,7 @@ class vacuum_worker_task : public cubthread::entry_task
       // safe-guard - check interrupt is always false
       assert (!thread_ref.check_interrupt);
       vacuum_process_log_block (&thread_ref, &m_data, false);
+      vacuum_Worker_job_count--;
     }
 
   private:
@@ -3022,6 +3038,7 @@ vacuum_master_task::execute (cubthread::entry &thread_ref)
   pgbuf_flush_if_requested (&thread_ref, (PAGE_PTR) vacuum_Data.last_page);
 
   m_cursor.force_data_update ();
+  adapt_worker_limit (thread_ref);
   vacuum_er_log (VACUUM_ER_LOG_MASTER | VACUUM_ER_LOG_JOBS, "Start searching jobs at " vacuum_job_cursor_print_format,
                  vacuum_job_cursor_print_args (m_cursor));
   for (; m_cursor.is_valid () && !should_interrupt_iteration (); m_cursor.increment_blockid ())
@@ -3076,9 +3093,46 @@ vacuum_master_task::is_task_queue_full() const
 }
 
 bool
-vacuum_master_task::should_interrupt_iteration () const
+vacuum_master_task::is_worker_limit_reached () const
 {
-  return check_shutdown () || is_task_queue_full ();
+  if (prm_get_bool_value (PRM_ID_VACUUM_ADAPTIVE_WORKER_CONTROL) && vacuum_Worker_job_count >= m_worker_limit)
+    {
+      vacuum_er_log (VACUUM_ER_LOG_MASTER, "Interrupt iteration: worker limit %d reached", m_worker_limit);
+      return true;
+    }
+  return false;
+}
+
+bool
+vacuum_master_task::is_io_budget_exhausted ()
+{
+  int max_blocks_per_second = prm_get_integer_value (PRM_ID_VACUUM_MAX_LOG_BLOCKS_PER_SECOND);
+  if (max_blocks_per_second <= 0)
+    {
+      // no budget
+      return false;
+    }
+
+  const auto now = std::chrono::steady_clock::now ();
+  if (now - m_io_budget_start >= std::chrono::seconds (1))
+    {
+      // new second, new budget
+      m_io_budget_start = now;
+      m_io_budget_blocks = 0;
+    }
+  if (m_io_budget_blocks >= max_blocks_per_second)
+    {
+      vacuum_er_log (VACUUM_ER_LOG_MASTER, "Interrupt iteration: I/O budget of %d blocks per second spent",
+                     max_blocks_per_second);
+      return true;
+    }
+  return false;
+}
+
+bool
+vacuum_master_task::should_interrupt_iteration ()
+{
+  return check_shutdown () || is_task_queue_full () || is_worker_limit_reached () || is_io_budget_exhausted ();
 }
 
 bool
@@ -3131,13 +3185,84 @@ vacuum_master_task::is_cursor_entry_available () const
 }
 
 void
-vacuum_master_task::start_job_on_cursor_entry () const
+vacuum_master_task::start_job_on_cursor_entry ()
 {
   m_cursor.start_job_on_current_entry ();
+  vacuum_Worker_job_count++;
+  m_io_budget_blocks++;
   cubthread::get_manager ()->push_task (vacuum_Worker_threads,
                                         new vacuum_worker_task (m_cursor.get_current_entry ()));
 }
 
+//
+// adapt_worker_limit () - scale the number of jobs that may run at once to the vacuum backlog and I/O pressure
+//
+// thread_ref (in) : master thread
+//
+// NOTE: while the backlog of log blocks grows beyond what the active workers handle, one more worker is allowed each
+//       iteration; once the backlog is small, one less. When page buffer I/O is stressful (threads wait for victims),
+//       the limit is halved so vacuum stops competing with the transactions, unless vacuum is so far behind that
+//       postponing it any longer would hurt more; then half of the workers are kept.
+//
+void
+vacuum_master_task::adapt_worker_limit (cubthread::entry &thread_ref)
+{
+  const int max_workers = prm_get_integer_value (PRM_ID_VACUUM_WORKER_COUNT);
+  int backlog_blocks = 0;
+  int backlog_log_pages = 0;
+  int min_workers = 1;
+  int new_limit;
+
+  if (!vacuum_Data.is_empty ())
+    {
+      VACUUM_LOG_BLOCKID first_blockid = vacuum_Data.get_first_blockid ();
+
+      backlog_blocks = (int) (vacuum_Data.get_last_blockid () - first_blockid + 1);
+      backlog_log_pages = (int) (log_Gl.append.prev_lsa.pageid - VACUUM_FIRST_LOG_PAGEID_IN_BLOCK (first_blockid));
+    }
+  perfmon_set_stat (&thread_ref, PSTAT_VAC_NUM_BACKLOG_BLOCKS, backlog_blocks, true);
+  perfmon_set_stat (&thread_ref, PSTAT_VAC_NUM_BACKLOG_LOG_PAGES, backlog_log_pages, true);
+
+  if (!prm_get_bool_value (PRM_ID_VACUUM_ADAPTIVE_WORKER_CONTROL))
+    {
+      m_worker_limit = max_workers;
+      perfmon_set_stat (&thread_ref, PSTAT_VAC_NUM_WORKER_LIMIT, m_worker_limit, true);
+      return;
+    }
+
+  if (m_worker_limit <= 0 || m_worker_limit > max_workers)
+    {
+      m_worker_limit = max_workers;
+    }
+  new_limit = m_worker_limit;
+
+  if (backlog_blocks >= max_workers * VACUUM_CRITICAL_BACKLOG_BLOCKS_PER_WORKER)
+    {
+      min_workers = MAX (1, max_workers / 2);
+    }
+
+  if (pgbuf_is_io_stressful ())
+    {
+      new_limit = MAX (min_workers, m_worker_limit / 2);
+    }
+  else if (backlog_blocks > m_worker_limit * VACUUM_BACKLOG_BLOCKS_PER_WORKER)
+    {
+      new_limit = MIN (max_workers, m_worker_limit + 1);
+    }
+  else if (backlog_blocks < m_worker_limit)
+    {
+      new_limit = MAX (min_workers, m_worker_limit - 1);
+    }
+
+  if (new_limit != m_worker_limit)
+    {
+      vacuum_er_log (VACUUM_ER_LOG_MASTER, "Change worker limit from %d to %d; backlog = %d blocks",
+                     m_worker_limit, new_limit, backlog_blocks);
+      m_worker_limit = new_limit;
+    }
+  perfmon_set_stat (&thread_ref, PSTAT_VAC_NUM_WORKER_LIMIT, m_worker_limit, true);
+}
+
 bool
 vacuum_master_task::should_force_data_update () const
 {
@@ -162,8 +162,10 @@ typedef struct topn_tuples TOPN_TUPLES;
 namespace cubquery
 {
   struct aggregate_hash_context;
+  class partition_prefetch;
 }
 using AGGREGATE_HASH_CONTEXT = cubquery::aggregate_hash_context;
+using PARTITION_PREFETCH = cubquery::partition_prefetch;
 // *INDENT-ON*
 
 typedef struct partition_spec_node PARTITION_SPEC_TYPE;
@@ -586,6 +588,7 @@ struct cte_proc_node
 #define XASL_INCLUDES_TDE_CLASS	      0x10000	/* is any tde class related */
 #define XASL_SAMPLING_SCAN	      0x20000	/* is sampling scan */
 #define XASL_USES_SQ_CACHE	      0x40000	/* subquery uses result cache */
+#define XASL_PIPELINED_SUBQUERY	      0x80000	/* tuples go to the list scan of the parent, not to the list file */
 
 #define XASL_IS_FLAGED(x, f)        (((x)->flag & (int) (f)) != 0)
 #define XASL_SET_FLAG(x, f)         (x)->flag |= (int) (f)
@@ -1082,6 +1085,7 @@ struct access_spec_node
   SCAN_ID s_id;			/* scan identifier */
   PARTITION_SPEC_TYPE *parts;	/* partitions of the current spec */
   PARTITION_SPEC_TYPE *curent;	/* current partition */
+  PARTITION_PREFETCH *parts_prefetch;	/* read-ahead of the partitions not scanned yet */
   bool grouped_scan;		/* grouped or regular scan? it is never true!!! */
   bool fixed_scan;		/* scan pages are kept fixed? */
   bool pruned;			/* true if partition pruning has been performed */
@@ -466,6 +466,21 @@ struct heap_chnguess
   int nbytes;			/* Number of bytes in bitindex. It must be aligned to multiples of 4 bytes (integers) */
 };
 
+/* Page a thread keeps inserting into while it has room, so that concurrent inserters of the same heap do not all go
+ * through the heap header and the same best page. Each thread uses its own hint; the best space cache clears hints of
+ * removed pages and files, so every access is protected by the hint mutex. */
+typedef struct heap_stats_insert_hint HEAP_STATS_INSERT_HINT;
+struct heap_stats_insert_hint
+{
+  pthread_mutex_t mutex;
+  HFID hfid;			/* heap of the hinted page */
+  OID class_oid;		/* class of the heap, to recognize the page is still ours */
+  VPID vpid;			/* hinted page */
+  int unfill_space;		/* unfill space of the heap header when the hint was taken */
+  int pending_num_recs;		/* header estimates not yet applied, added on next header access */
+  float pending_recs_sumlen;
+};
+
 typedef struct heap_stats_bestspace_cache HEAP_STATS_BESTSPACE_CACHE;
 struct heap_stats_bestspace_cache
 {
@@ -475,6 +490,8 @@ struct heap_stats_bestspace_cache
   int free_list_count;		/* number of entries in free */
   HEAP_STATS_ENTRY *free_list;
   pthread_mutex_t bestspace_mutex;
+  int num_insert_hints;		/* number of insert hints, one per thread */
+  HEAP_STATS_INSERT_HINT *insert_hints;
 };
 
 typedef struct heap_show_scan_ctx HEAP_SHOW_SCAN_CTX;
@@ -495,7 +512,8 @@ static HEAP_CHNGUESS heap_Guesschn_area = { NULL, NULL, NULL, false, 0,
 
 static HEAP_CHNGUESS *heap_Guesschn = NULL;
 
-static HEAP_STATS_BESTSPACE_CACHE heap_Bestspace_cache_area = { 0, NULL, NULL, 0, NULL, PTHREAD_MUTEX_INITIALIZER };
+static HEAP_STATS_BESTSPACE_CACHE heap_Bestspace_cache_area =
+  { 0, NULL, NULL, 0, NULL, PTHREAD_MUTEX_INITIALIZER, 0, NULL };
 
 static HEAP_STATS_BESTSPACE_CACHE *heap_Bestspace = NULL;
 
@@ -628,6 +646,9 @@ static HEAP_FINDSPACE heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p
 							 HEAP_SCANCACHE * scan_cache, PGBUF_WATCHER * pg_watcher);
 static PAGE_PTR heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int needed_space, bool isnew_rec,
 					   int newrec_size, HEAP_SCANCACHE * space_cache, PGBUF_WATCHER * pg_watcher);
+static HEAP_STATS_INSERT_HINT *heap_stats_get_insert_hint (THREAD_ENTRY * thread_p);
+static PAGE_PTR heap_stats_find_page_in_insert_hint (THREAD_ENTRY * thread_p, const HFID * hfid, int needed_space,
+						     bool isnew_rec, int newrec_size, PGBUF_WATCHER * pg_watcher);
 static int heap_stats_sync_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_STATS * heap_hdr,
 				      VPID * hdr_vpid, bool scan_all, bool can_cycle);
 
@@ -1096,6 +1117,7 @@ heap_stats_del_bestspace_by_hfid (THREAD_ENTRY * thread_p, const HFID * hfid)
 {
   HEAP_STATS_ENTRY *ent;
   int del_cnt = 0;
+  int i;
   int rc;
   PERF_UTIME_TRACKER time_best_space = PERF_UTIME_TRACKER_INITIALIZER;
 
@@ -1117,6 +1139,23 @@ heap_stats_del_bestspace_by_hfid (THREAD_ENTRY * thread_p, const HFID * hfid)
 
   heap_Bestspace->num_stats_entries -= del_cnt;
 
+  /* the file is destroyed or reused, its pages must no longer be hinted */
+  for (i = 0; i < heap_Bestspace->num_insert_hints; i++)
+    {
+      HEAP_STATS_INSERT_HINT *insert_hint = &heap_Bestspace->insert_hints[i];
+
+      pthread_mutex_lock (&insert_hint->mutex);
+      if (HFID_EQ (&insert_hint->hfid, hfid))
+	{
+	  HFID_SET_NULL (&insert_hint->hfid);
+	  OID_SET_NULL (&insert_hint->class_oid);
+	  VPID_SET_NULL (&insert_hint->vpid);
+	  insert_hint->pending_num_recs = 0;
+	  insert_hint->pending_recs_sumlen = 0;
+	}
+      pthread_mutex_unlock (&insert_hint->mutex);
+    }
+
   assert (mht_count (heap_Bestspace->vpid_ht) == mht_count (heap_Bestspace->hfid_ht));
   pthread_mutex_unlock (&heap_Bestspace->bestspace_mutex);
 
@@ -1141,6 +1180,8 @@ heap_stats_del_bestspace_by_vpid (THREAD_ENTRY * thread_p, VPID * vpid)
   PERF_UTIME_TRACKER_START (thread_p, &time_best_space);
   rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
 
+  /* insert hints are not swept here: a hint on a deallocated page is dropped by its owner, which checks the page
+   * type and the class of the heap chain after fixing the page */
   ent = (HEAP_STATS_ENTRY *) mht_get (heap_Bestspace->vpid_ht, vpid);
   if (ent == NULL)
     {
@@ -3515,6 +3556,7 @@ heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int neede
   int num_pages_found;
   float other_high_best_ratio;
   PGBUF_WATCHER hdr_page_watcher;
+  HEAP_STATS_INSERT_HINT *insert_hint;
   int error_code = NO_ERROR;
   PERF_UTIME_TRACKER time_find_best_page = PERF_UTIME_TRACKER_INITIALIZER;
 
@@ -3525,6 +3567,14 @@ heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int neede
    */
 
   assert (scan_cache == NULL || scan_cache->cache_last_fix_page == false || scan_cache->page_watcher.pgptr == NULL);
+
+  /* First try the page this thread inserted into last time. */
+  if (heap_stats_find_page_in_insert_hint (thread_p, hfid, needed_space, isnew_rec, newrec_size, pg_watcher) != NULL)
+    {
+      PERF_UTIME_TRACKER_TIME (thread_p, &time_find_best_page, PSTAT_HF_HEAP_FIND_BEST_PAGE);
+      return pg_watcher->pgptr;
+    }
+
   PGBUF_INIT_WATCHER (&hdr_page_watcher, PGBUF_ORDERED_HEAP_HDR, hfid);
 
   /*
@@ -3564,6 +3614,21 @@ heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int neede
 
   heap_hdr = (HEAP_HDR_STATS *) hdr_recdes.data;
 
+  insert_hint = heap_stats_get_insert_hint (thread_p);
+  if (insert_hint != NULL)
+    {
+      pthread_mutex_lock (&insert_hint->mutex);
+      if (HFID_EQ (&insert_hint->hfid, hfid))
+	{
+	  /* add the records inserted through the hint since the last header access */
+	  heap_hdr->estimates.num_recs += insert_hint->pending_num_recs;
+	  heap_hdr->estimates.recs_sumlen += insert_hint->pending_recs_sumlen;
+	}
+      insert_hint->pending_num_recs = 0;
+      insert_hint->pending_recs_sumlen = 0;
+      pthread_mutex_unlock (&insert_hint->mutex);
+    }
+
   if (isnew_rec == true)
     {
       heap_hdr->estimates.num_recs += 1;
@@ -3678,6 +3743,17 @@ heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int neede
 	      || er_errid () == ER_FILE_NOT_ENOUGH_PAGES_IN_DATABASE);
     }
 
+  if (insert_hint != NULL && pg_watcher->pgptr != NULL)
+    {
+      /* keep inserting into this page while it has room */
+      pthread_mutex_lock (&insert_hint->mutex);
+      HFID_COPY (&insert_hint->hfid, hfid);
+      COPY_OID (&insert_hint->class_oid, &heap_hdr->class_oid);
+      pgbuf_get_vpid (pg_watcher->pgptr, &insert_hint->vpid);
+      insert_hint->unfill_space = heap_hdr->unfill_space;
+      pthread_mutex_unlock (&insert_hint->mutex);
+    }
+
   addr_hdr.pgptr = hdr_page_watcher.pgptr;
   log_skip_logging (thread_p, &addr_hdr);
   pgbuf_ordered_set_dirty_and_free (thread_p, &hdr_page_watcher);
@@ -3692,6 +3768,143 @@ error:
   return NULL;
 }
 
+/*
+ * heap_stats_get_insert_hint () - Get the insert hint of current thread
+ *   return: insert hint or NULL
+ */
+static HEAP_STATS_INSERT_HINT *
+heap_stats_get_insert_hint (THREAD_ENTRY * thread_p)
+{
+  if (heap_Bestspace == NULL || heap_Bestspace->insert_hints == NULL)
+    {
+      return NULL;
+    }
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  if (thread_p->index < 0 || thread_p->index >= heap_Bestspace->num_insert_hints)
+    {
+      return NULL;
+    }
+
+  return &heap_Bestspace->insert_hints[thread_p->index];
+}
+
+/*
+ * heap_stats_find_page_in_insert_hint () - Fix the page current thread last inserted into, if it still has the
+ *					    needed space
+ *   return: pointer to page with enough space or NULL
+ *   hfid(in): Object heap file identifier
+ *   needed_space(in): The minimal space needed
+ *   isnew_rec(in): Are we inserting a new record to the heap ?
+ *   newrec_size(in): Size of the new record
+ *   pg_watcher(out): Watcher for the page
+ *
+ * Note: The heap header is not fixed, its estimates are updated next time the thread goes through
+ *       heap_stats_find_best_page. The page is never waited for: if another thread holds it, the hint is dropped and
+ *       the caller looks for another page, which spreads concurrent inserters over different pages.
+ */
+static PAGE_PTR
+heap_stats_find_page_in_insert_hint (THREAD_ENTRY * thread_p, const HFID * hfid, int needed_space, bool isnew_rec,
+				     int newrec_size, PGBUF_WATCHER * pg_watcher)
+{
+  HEAP_STATS_INSERT_HINT *insert_hint;
+  VPID vpid;
+  OID class_oid;
+  int unfill_space;
+  PAGE_PTR pgptr;
+  HEAP_CHAIN *chain;
+  int total_space;
+
+  insert_hint = heap_stats_get_insert_hint (thread_p);
+  if (insert_hint == NULL || newrec_size > DB_PAGESIZE)
+    {
+      return NULL;
+    }
+
+  if (er_errid () != NO_ERROR)
+    {
+      /* let heap_stats_find_best_page handle it */
+      return NULL;
+    }
+
+  pthread_mutex_lock (&insert_hint->mutex);
+  if (VPID_ISNULL (&insert_hint->vpid) || !HFID_EQ (&insert_hint->hfid, hfid))
+    {
+      pthread_mutex_unlock (&insert_hint->mutex);
+      return NULL;
+    }
+  VPID_COPY (&vpid, &insert_hint->vpid);
+  COPY_OID (&class_oid, &insert_hint->class_oid);
+  unfill_space = insert_hint->unfill_space;
+  pthread_mutex_unlock (&insert_hint->mutex);
+
+  total_space = needed_space + heap_Slotted_overhead + unfill_space;
+  if (heap_is_big_length (total_space))
+    {
+      total_space = needed_space + heap_Slotted_overhead;
+    }
+
+  /* the page may have been removed by vacuum meanwhile */
+  pgptr = pgbuf_fix (thread_p, &vpid, OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_WRITE, PGBUF_CONDITIONAL_LATCH);
+  if (pgptr == NULL)
+    {
+      if (er_errid () == ER_PB_BAD_PAGEID)
+	{
+	  er_clear ();
+	}
+      goto drop_hint;
+    }
+
+  if (pgbuf_get_page_ptype (thread_p, pgptr) != PAGE_HEAP)
+    {
+      pgbuf_unfix_and_init (thread_p, pgptr);
+      goto drop_hint;
+    }
+
+  /* the page may have been deallocated and reused by another heap; the class OID is the first member of both the
+   * chain and the header record */
+  chain = heap_get_chain_ptr (thread_p, pgptr);
+  if (chain == NULL || !OID_EQ (&chain->class_oid, &class_oid)
+      || spage_max_space_for_new_record (thread_p, pgptr) < total_space)
+    {
+      pgbuf_unfix_and_init (thread_p, pgptr);
+      goto drop_hint;
+    }
+
+  pthread_mutex_lock (&insert_hint->mutex);
+  if (!VPID_EQ (&insert_hint->vpid, &vpid) || !HFID_EQ (&insert_hint->hfid, hfid))
+    {
+      /* the hint was cleared meanwhile */
+      pthread_mutex_unlock (&insert_hint->mutex);
+      pgbuf_unfix_and_init (thread_p, pgptr);
+      return NULL;
+    }
+  if (isnew_rec == true)
+    {
+      insert_hint->pending_num_recs++;
+    }
+  insert_hint->pending_recs_sumlen += (float) newrec_size;
+  pthread_mutex_unlock (&insert_hint->mutex);
+
+  pgbuf_attach_watcher (thread_p, pgptr, PGBUF_LATCH_WRITE, (HFID *) hfid, pg_watcher);
+
+  return pg_watcher->pgptr;
+
+drop_hint:
+  pthread_mutex_lock (&insert_hint->mutex);
+  if (VPID_EQ (&insert_hint->vpid, &vpid))
+    {
+      VPID_SET_NULL (&insert_hint->vpid);
+    }
+  pthread_mutex_unlock (&insert_hint->mutex);
+
+  return NULL;
+}
+
 /*
  * heap_stats_sync_bestspace () - Synchronize the statistics of best space
  *   return: the number of pages found
@@ -15335,6 +15548,7 @@ static int
 heap_stats_bestspace_initialize (void)
 {
   int ret = NO_ERROR;
+  int i;
 
   if (heap_Bestspace != NULL)
     {
@@ -15368,6 +15582,28 @@ heap_stats_bestspace_initialize (void)
   heap_Bestspace->free_list_count = 0;
   heap_Bestspace->free_list = NULL;
 
+  heap_Bestspace->num_insert_hints = (int) thread_num_total_threads ();
+  heap_Bestspace->insert_hints =
+    (HEAP_STATS_INSERT_HINT *) malloc (heap_Bestspace->num_insert_hints * sizeof (HEAP_STATS_INSERT_HINT));
+  if (heap_Bestspace->insert_hints == NULL)
+    {
+      ret = ER_OUT_OF_VIRTUAL_MEMORY;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ret, 1,
+	      heap_Bestspace->num_insert_hints * sizeof (HEAP_STATS_INSERT_HINT));
+      heap_Bestspace->num_insert_hints = 0;
+      goto exit_on_error;
+    }
+  for (i = 0; i < heap_Bestspace->num_insert_hints; i++)
+    {
+      pthread_mutex_init (&heap_Bestspace->insert_hints[i].mutex, NULL);
+      HFID_SET_NULL (&heap_Bestspace->insert_hints[i].hfid);
+      OID_SET_NULL (&heap_Bestspace->insert_hints[i].class_oid);
+      VPID_SET_NULL (&heap_Bestspace->insert_hints[i].vpid);
+      heap_Bestspace->insert_hints[i].unfill_space = 0;
+      heap_Bestspace->insert_hints[i].pending_num_recs = 0;
+      heap_Bestspace->insert_hints[i].pending_recs_sumlen = 0;
+    }
+
   return ret;
 
 exit_on_error:
@@ -15385,6 +15621,7 @@ static int
 heap_stats_bestspace_finalize (void)
 {
   HEAP_STATS_ENTRY *ent;
+  int i;
   int ret = NO_ERROR;
 
   if (heap_Bestspace == NULL)
@@ -15422,6 +15659,16 @@ heap_stats_bestspace_finalize (void)
       heap_Bestspace->hfid_ht = NULL;
     }
 
+  if (heap_Bestspace->insert_hints != NULL)
+    {
+      for (i = 0; i < heap_Bestspace->num_insert_hints; i++)
+	{
+	  pthread_mutex_destroy (&heap_Bestspace->insert_hints[i].mutex);
+	}
+      free_and_init (heap_Bestspace->insert_hints);
+    }
+  heap_Bestspace->num_insert_hints = 0;
+
   pthread_mutex_destroy (&heap_Bestspace->bestspace_mutex);
 
   heap_Bestspace = NULL;
@@ -201,6 +201,8 @@ static DISK_ISVALID locator_check_unique_btree_entries (THREAD_ENTRY * thread_p,
 static int locator_eval_filter_predicate (THREAD_ENTRY * thread_p, BTID * btid, OR_PREDICATE * or_pred, OID * class_oid,
 					  OID ** inst_oids, int num_insts, RECDES ** recs, DB_LOGICAL * results);
 static bool locator_was_index_already_applied (HEAP_CACHE_ATTRINFO * index_attrinfo, BTID * btid, int pos);
+static bool locator_index_attrs_unchanged (OR_INDEX * index, HEAP_CACHE_ATTRINFO * old_attrinfo,
+					  HEAP_CACHE_ATTRINFO * new_attrinfo);
 static LC_FIND_CLASSNAME xlocator_reserve_class_name (THREAD_ENTRY * thread_p, const char *classname, OID * class_oid);
 
 static int locator_filter_errid (THREAD_ENTRY * thread_p, int num_ignore_error_count, int *ignore_error_list);
@@ -7676,6 +7678,61 @@ locator_was_index_already_applied (HEAP_CACHE_ATTRINFO * index_attrinfo, BTID *
   return false;
 }
 
+/*
+ * locator_index_attrs_unchanged () - Check whether an update left all the key attributes of an index untouched
+ *
+ * return: true if every key attribute has the same value in both versions
+ *
+ *   index(in): index to check
+ *   old_attrinfo(in): attribute values of the old version
+ *   new_attrinfo(in): attribute values of the new version
+ *
+ * Note: When the key attributes are equal the keys are equal too, so the caller can skip building and comparing the
+ *       old and new keys. Indexes with a filter predicate or a function are not covered, since their entries also
+ *       depend on values other than the plain key attributes.
+ */
+static bool
+locator_index_attrs_unchanged (OR_INDEX * index, HEAP_CACHE_ATTRINFO * old_attrinfo, HEAP_CACHE_ATTRINFO * new_attrinfo)
+{
+  DB_VALUE *old_value, *new_value;
+  bool old_isnull, new_isnull;
+  int k;
+
+  if (index->filter_predicate != NULL || index->func_index_info != NULL)
+    {
+      return false;
+    }
+
+  for (k = 0; k < index->n_atts; k++)
+    {
+      old_value = heap_attrinfo_access (index->atts[k]->id, old_attrinfo);
+      new_value = heap_attrinfo_access (index->atts[k]->id, new_attrinfo);
+      if (old_value == NULL || new_value == NULL)
+	{
+	  return false;
+	}
+
+      old_isnull = db_value_is_null (old_value);
+      new_isnull = db_value_is_null (new_value);
+      if (old_isnull || new_isnull)
+	{
+	  if (old_isnull != new_isnull)
+	    {
+	      return false;
+	    }
+	  continue;
+	}
+
+      if (DB_VALUE_DOMAIN_TYPE (old_value) != DB_VALUE_DOMAIN_TYPE (new_value)
+	  || tp_value_compare (old_value, new_value, 0, 1) != DB_EQ)
+	{
+	  return false;
+	}
+    }
+
+  return true;
+}
+
 /*
  * locator_add_or_remove_index () - Add or remove index entries
  *
@@ -8497,6 +8554,13 @@ locator_update_index (THREAD_ENTRY * thread_p, RECDES * new_recdes, RECDES * old
 	    }
 	}
 
+      if (!do_delete_only && !do_insert_only && locator_index_attrs_unchanged (index, old_attrinfo, new_attrinfo))
+	{
+	  /* The update did not touch the key attributes, the entry of this object stays as it is. If this is the primary
+	   * key, the old key needed for replication is built after the loop. */
+	  continue;
+	}
+
       new_key =
 	heap_attrvalue_get_key (thread_p, i, new_attrinfo, new_recdes, &new_btid, &new_dbvalue, aligned_newbuf, NULL,
 				NULL, oid, false);
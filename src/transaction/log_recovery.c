@@ -42,6 +42,7 @@
 #include "recovery.h"
 #include "slotted_page.h"
 #include "system_parameter.h"
+#include "thread_entry_task.hpp"
 #include "thread_manager.hpp"
 // XXX: SHOULD BE THE LAST INCLUDE HEADER
 #include "memory_wrapper.hpp"
@@ -99,6 +100,7 @@ static int log_recovery_get_redo_parallel_count ();
 #endif
 
 static void log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const LOG_LSA * end_redo_lsa);
+static void log_recovery_flush_data_pages (THREAD_ENTRY * thread_p);
 static void log_recovery_abort_interrupted_sysop (THREAD_ENTRY * thread_p, LOG_TDES * tdes,
 						  const LOG_LSA * postpone_start_lsa);
 static void log_recovery_finish_sysop_postpone (THREAD_ENTRY * thread_p, LOG_TDES * tdes);
@@ -107,6 +109,13 @@ static void log_recovery_finish_all_postpone (THREAD_ENTRY * thread_p);
 static void log_recovery_abort_atomic_sysop (THREAD_ENTRY * thread_p, LOG_TDES * tdes);
 static void log_recovery_abort_all_atomic_sysops (THREAD_ENTRY * thread_p);
 static void log_recovery_undo (THREAD_ENTRY * thread_p);
+#if defined (SERVER_MODE)
+static bool log_rv_undo_needs_sequential (THREAD_ENTRY * thread_p);
+static void log_recovery_undo_parallel (THREAD_ENTRY * thread_p, int info_logging_interval_in_secs,
+					const TSC_TICKS * info_logging_start_time);
+#endif
+static bool log_rv_undo_tdes_record (THREAD_ENTRY * thread_p, LOG_TDES * tdes, LOG_LSA * log_lsa, LOG_PAGE * log_pgptr,
+				     LOG_ZIP * undo_unzip_ptr);
 static void log_recovery_notpartof_archives (THREAD_ENTRY * thread_p, int start_arv_num, const char *info_reason);
 static bool log_unformat_ahead_volumes (THREAD_ENTRY * thread_p, VOLID volid, VOLID * start_volid);
 static void log_recovery_notpartof_volumes (THREAD_ENTRY * thread_p);
@@ -922,7 +931,7 @@ log_recovery (THREAD_ENTRY * thread_p, int ismedia_crash, time_t * stopat)
 
   /* Flush all dirty pages */
   logpb_flush_pages_direct (thread_p);
-  (void) pgbuf_flush_all (thread_p, NULL_VOLID);
+  log_recovery_flush_data_pages (thread_p);
   (void) fileio_synchronize_all (thread_p, false);
 
   logpb_flush_header (thread_p);
@@ -3209,6 +3218,269 @@ log_recovery_get_redo_parallel_count ()
 }
 #endif
 
+/*
+ * log_recovery_flush_data_pages - flush the data pages modified by a recovery phase
+ *
+ * return: nothing
+ *
+ * NOTE: With recovery_defer_page_flush, the dirty pages are left in the page
+ *              buffer and the server opens as soon as redo and undo have been
+ *              applied. The pages are written by the page flush daemon, and the
+ *              checkpoint taken at the end of recovery keeps the redo LSA of the
+ *              oldest of them, exactly as for pages dirtied at run time.
+ */
+static void
+log_recovery_flush_data_pages (THREAD_ENTRY * thread_p)
+{
+#if defined (SERVER_MODE)
+  if (prm_get_bool_value (PRM_ID_RECOVERY_DEFER_PAGE_FLUSH))
+    {
+      return;
+    }
+#endif /* SERVER_MODE */
+
+  (void) pgbuf_flush_all (thread_p, NULL_VOLID);
+}
+
+#if defined (SERVER_MODE)
+// *INDENT-OFF*
+/*
+ * log_rv_redo_prefetch_sync - progress of the redo shared with the read ahead of its data pages
+ */
+class log_rv_redo_prefetch_sync
+{
+  public:
+    explicit log_rv_redo_prefetch_sync (LOG_PAGEID apply_pageid)
+      : m_mutex ()
+      , m_cond ()
+      , m_apply_pageid (apply_pageid)
+      , m_stop (false)
+      , m_done (false)
+    {
+    }
+
+    /* called by the redo for every record; the read ahead is only woken when the redo reaches a new log page */
+    void set_apply_pageid (LOG_PAGEID pageid)
+    {
+      if (m_apply_pageid.load (std::memory_order_relaxed) == pageid)
+	{
+	  return;
+	}
+
+      std::lock_guard<std::mutex> lock (m_mutex);
+      m_apply_pageid = pageid;
+      m_cond.notify_all ();
+    }
+
+    /* wait until the page is within the distance in front of the redo; false if the read ahead must stop */
+    bool wait_for_page (LOG_PAGEID pageid, int distance)
+    {
+      if (pageid <= m_apply_pageid + distance)
+	{
+	  return !m_stop;
+	}
+
+      std::unique_lock<std::mutex> lock (m_mutex);
+      m_cond.wait (lock, [&] { return m_stop || pageid <= m_apply_pageid + distance; });
+      return !m_stop;
+    }
+
+    bool is_stopped () const
+    {
+      return m_stop;
+    }
+
+    void set_done ()
+    {
+      std::lock_guard<std::mutex> lock (m_mutex);
+      m_done = true;
+      m_cond.notify_all ();
+    }
+
+    void stop_and_wait ()
+    {
+      std::unique_lock<std::mutex> lock (m_mutex);
+      m_stop = true;
+      m_cond.notify_all ();
+      m_cond.wait (lock, [this] { return m_done; });
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::atomic<LOG_PAGEID> m_apply_pageid;
+    std::atomic<bool> m_stop;
+    bool m_done;			// protected by m_mutex
+};
+
+/*
+ * log_rv_redo_prefetch_task - read ahead the data pages of the records that the redo is about to apply
+ *
+ * NOTE: The task follows the log records up to recovery_redo_prefetch_distance log pages in front of the
+ *              redo and fixes the pages they change, so that the redo finds them already in the page buffer.
+ *              The pages are only read, never modified; any page that cannot be fixed right away is skipped
+ *              and left to the redo.
+ */
+class log_rv_redo_prefetch_task : public cubthread::entry_task
+{
+  public:
+    log_rv_redo_prefetch_task (const LOG_LSA &start_lsa, const LOG_LSA &end_lsa, int distance,
+			       log_rv_redo_prefetch_sync &sync)
+      : m_start_lsa (start_lsa)
+      , m_end_lsa (end_lsa)
+      , m_distance (distance)
+      , m_sync (sync)
+    {
+    }
+
+    void execute (cubthread::entry &thread_ref) override;
+
+  private:
+    template <typename T>
+    void prefetch_record_page (THREAD_ENTRY *thread_p, log_reader &reader, VPID &last_vpid);
+
+    const LOG_LSA m_start_lsa;
+    const LOG_LSA m_end_lsa;
+    const int m_distance;
+    log_rv_redo_prefetch_sync &m_sync;
+};
+
+template <typename T>
+void
+log_rv_redo_prefetch_task::prefetch_record_page (THREAD_ENTRY *thread_p, log_reader &reader, VPID &last_vpid)
+{
+  PAGE_PTR pgptr;
+
+  reader.add_align (sizeof (LOG_RECORD_HEADER));
+  reader.advance_when_does_not_fit (sizeof (T));
+  const VPID vpid = log_rv_get_log_rec_vpid<T> (*reader.reinterpret_cptr<T> ());
+
+  if (VPID_ISNULL (&vpid) || VPID_EQ (&vpid, &last_vpid)
+      || fileio_get_volume_descriptor (vpid.volid) == NULL_VOLDES)
+    {
+      return;
+    }
+  last_vpid = vpid;
+
+  pgptr = pgbuf_fix (thread_p, &vpid, RECOVERY_PAGE, PGBUF_LATCH_READ, PGBUF_CONDITIONAL_LATCH);
+  if (pgptr == NULL)
+    {
+      /* the redo will fix the page itself */
+      er_clear ();
+      return;
+    }
+  pgbuf_unfix (thread_p, pgptr);
+}
+
+void
+log_rv_redo_prefetch_task::execute (cubthread::entry &thread_ref)
+{
+  THREAD_ENTRY *thread_p = &thread_ref;
+  log_reader reader (LOG_CS_FORCE_USE);
+  LOG_LSA lsa = m_start_lsa;
+  VPID last_vpid = VPID_INITIALIZER;
+
+  while (!LSA_ISNULL (&lsa) && LSA_LE (&lsa, &m_end_lsa) && !m_sync.is_stopped ())
+    {
+      /* stay within the distance in front of the redo */
+      if (!m_sync.wait_for_page (lsa.pageid, m_distance))
+	{
+	  break;
+	}
+
+      if (lsa.offset == NULL_OFFSET)
+	{
+	  if (reader.set_lsa_and_fetch_page (lsa) != NO_ERROR)
+	    {
+	      break;
+	    }
+	  lsa.offset = reader.get_page_header ().offset;
+	  if (lsa.offset == NULL_OFFSET)
+	    {
+	      lsa.pageid++;
+	      continue;
+	    }
+	}
+
+      if (reader.set_lsa_and_fetch_page (lsa) != NO_ERROR)
+	{
+	  break;
+	}
+
+      const LOG_RECORD_HEADER *log_rec_header = reader.reinterpret_cptr<LOG_RECORD_HEADER> ();
+      const LOG_RECTYPE log_rtype = log_rec_header->type;
+      const LOG_LSA forw_lsa = log_rec_header->forw_lsa;
+
+      switch (log_rtype)
+	{
+	case LOG_MVCC_UNDOREDO_DATA:
+	case LOG_MVCC_DIFF_UNDOREDO_DATA:
+	  prefetch_record_page<LOG_REC_MVCC_UNDOREDO> (thread_p, reader, last_vpid);
+	  break;
+	case LOG_UNDOREDO_DATA:
+	case LOG_DIFF_UNDOREDO_DATA:
+	  prefetch_record_page<LOG_REC_UNDOREDO> (thread_p, reader, last_vpid);
+	  break;
+	case LOG_MVCC_REDO_DATA:
+	  prefetch_record_page<LOG_REC_MVCC_REDO> (thread_p, reader, last_vpid);
+	  break;
+	case LOG_REDO_DATA:
+	  prefetch_record_page<LOG_REC_REDO> (thread_p, reader, last_vpid);
+	  break;
+	case LOG_RUN_POSTPONE:
+	  prefetch_record_page<LOG_REC_RUN_POSTPONE> (thread_p, reader, last_vpid);
+	  break;
+	case LOG_COMPENSATE:
+	  prefetch_record_page<LOG_REC_COMPENSATE> (thread_p, reader, last_vpid);
+	  break;
+	default:
+	  break;
+	}
+
+      if (LSA_ISNULL (&forw_lsa) && logpb_is_page_in_archive (lsa.pageid))
+	{
+	  /* incomplete record archived; continue with the next page */
+	  lsa.pageid++;
+	  lsa.offset = NULL_OFFSET;
+	}
+      else if (LSA_LE (&forw_lsa, &lsa))
+	{
+	  /* let the redo report a loop in the log */
+	  break;
+	}
+      else
+	{
+	  lsa = forw_lsa;
+	}
+    }
+
+  m_sync.set_done ();
+}
+
+/*
+ * log_recovery_redo_stop_prefetch - stop the read ahead of the redo data pages
+ *
+ * return: nothing
+ *
+ *   workpool(in/out): prefetch worker pool; set to NULL once destroyed
+ *   sync(in/out): progress shared with the prefetch task
+ */
+static void
+log_recovery_redo_stop_prefetch (cubthread::entry_workpool *&workpool, log_rv_redo_prefetch_sync &sync)
+{
+  if (workpool == NULL)
+    {
+      return;
+    }
+
+  sync.stop_and_wait ();
+
+  cubthread::get_manager ()->destroy_worker_pool (workpool);
+  workpool = NULL;
+}
+// *INDENT-ON*
+#endif /* SERVER_MODE */
+
 /*
  * log_recovery_redo - SCAN FORWARD REDOING DATA
  *
@@ -3275,6 +3547,27 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
   // *INDENT-OFF*
   parallel_recovery_redo.reset (new cublog::redo_parallel (log_recovery_redo_parallel_count, false, MAX_LSA, redo_context));
   // *INDENT-ON*
+
+  /* read ahead the data pages of the upcoming log records */
+  const int prefetch_distance = prm_get_integer_value (PRM_ID_RECOVERY_REDO_PREFETCH_DISTANCE);
+  cubthread::entry_workpool *prefetch_workpool = NULL;
+  // *INDENT-OFF*
+  log_rv_redo_prefetch_sync prefetch_sync (start_redolsa->pageid);
+  cubthread::system_worker_entry_manager prefetch_context_manager (TT_RECOVERY);
+  // *INDENT-ON*
+
+  if (prefetch_distance > 0)
+    {
+      prefetch_workpool =
+	cubthread::get_manager ()->create_worker_pool (1, 1, "log_recovery_redo_prefetch_thread_pool",
+						       &prefetch_context_manager, 1, false);
+      if (prefetch_workpool != NULL)
+	{
+	  cubthread::get_manager ()->push_task (prefetch_workpool,
+						new log_rv_redo_prefetch_task (*start_redolsa, *end_redo_lsa,
+									       prefetch_distance, prefetch_sync));
+	}
+    }
 #endif
 
   // *INDENT-OFF*
@@ -3332,10 +3625,17 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 	    {
 	      LSA_SET_NULL (&log_Gl.unique_stats_table.curr_rcv_rec_lsa);
 	      logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_recovery_redo");
+#if defined(SERVER_MODE)
+	      log_recovery_redo_stop_prefetch (prefetch_workpool, prefetch_sync);
+#endif
 	      return;
 	    }
 	}
 
+#if defined(SERVER_MODE)
+      prefetch_sync.set_apply_pageid (lsa.pageid);
+#endif
+
       /* PRM_ID_RECOVERY_PROGRESS_LOGGING_INTERVAL > 0 */
       if (info_logging_interval_in_secs > 0)
 	{
@@ -3876,6 +4176,8 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 #undef INVOKE_REDO_RECORD
 
 #if defined(SERVER_MODE)
+  log_recovery_redo_stop_prefetch (prefetch_workpool, prefetch_sync);
+
   {
     // *INDENT-OFF*
     /* 'main' measures the time taken by the main thread to execute sync log records and dispatch async ones */
@@ -3918,9 +4220,13 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
   logpb_flush_pages_direct (thread_p);
 
   logpb_flush_header (thread_p);
-  (void) pgbuf_flush_all (thread_p, NULL_VOLID);
+  log_recovery_flush_data_pages (thread_p);
 
 exit:
+#if defined(SERVER_MODE)
+  log_recovery_redo_stop_prefetch (prefetch_workpool, prefetch_sync);
+#endif
+
   LSA_SET_NULL (&log_Gl.unique_stats_table.curr_rcv_rec_lsa);
 
 #if !defined(NDEBUG)
@@ -4402,109 +4708,311 @@ log_recovery_abort_atomic_sysop (THREAD_ENTRY * thread_p, LOG_TDES * tdes)
   LSA_SET_NULL (&tdes->rcv.atomic_sysop_start_lsa);
 }
 
+#if defined (SERVER_MODE)
 /*
- * log_recovery_undo - SCAN BACKWARDS UNDOING DATA
+ * log_rv_undo_needs_sequential - is there undo work left that cannot be given to the parallel undo?
  *
- * return: nothing
+ * return: true if undo must go on sequentially
  *
+ * NOTE: Undo must follow the reverse order of the log as long as a system
+ *              transaction has undo work, or a worker transaction is inside a
+ *              system operation that was open at the time of the crash (a page
+ *              split or a page allocation); such an operation must be undone
+ *              before anybody else walks through the structures it changed.
+ *              Records logged outside of system operations do not hold anybody
+ *              back.
  */
-static void
-log_recovery_undo (THREAD_ENTRY * thread_p)
+static bool
+log_rv_undo_needs_sequential (THREAD_ENTRY * thread_p)
 {
-  LOG_LSA max_undo_lsa = NULL_LSA;	/* LSA of log record to undo */
-  char log_pgbuf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT], *aligned_log_pgbuf;
-  LOG_PAGE *log_pgptr = NULL;	/* Log page pointer where LSA is located */
-  LOG_LSA log_lsa;
-  LOG_RECORD_HEADER *log_rec = NULL;	/* Pointer to log record */
-  LOG_REC_UNDOREDO *undoredo = NULL;	/* Undo_redo log record */
-  LOG_REC_UNDO *undo = NULL;	/* Undo log record */
-  LOG_REC_MVCC_UNDOREDO *mvcc_undoredo = NULL;	/* MVCC op Undo_redo log record */
-  LOG_REC_MVCC_UNDO *mvcc_undo = NULL;	/* MVCC op Undo log record */
-  LOG_REC_COMPENSATE *compensate;	/* Compensating log record */
-  LOG_REC_SYSOP_END *sysop_end;	/* Result of top system op */
-  LOG_RCVINDEX rcvindex;	/* Recovery index function */
-  LOG_RCV rcv;			/* Recovery structure */
-  VPID rcv_vpid;		/* VPID of data to recover */
-  LOG_LSA rcv_lsa;		/* Address of redo log record */
-  LOG_LSA prev_tranlsa;		/* prev LSA of transaction */
-  LOG_TDES *tdes;		/* Transaction descriptor */
-  int tran_index;
-  int data_header_size = 0;
-  LOG_ZIP *undo_unzip_ptr = NULL;
-  int cnt_trans_to_undo = 0;
-  LOG_LSA min_lsa = NULL_LSA;
-  LOG_LSA max_lsa = NULL_LSA;
-  bool is_mvcc_op;
-  volatile TRANID tran_id;
-  volatile LOG_RECTYPE log_rtype;
-  TSC_TICKS info_logging_start_time, info_logging_check_time;
-  TSCTIMEVAL info_logging_elapsed_time;
-  int info_logging_interval_in_secs = 0;
-  UINT64 total_page_cnt = 0, read_page_cnt = 0;
-
-  aligned_log_pgbuf = PTR_ALIGN (log_pgbuf, MAX_ALIGNMENT);
-
-  /*
-   * Remove from the list of transaction to abort, those that have finished
-   * when the crash happens, so it does not remain dangling in the transaction
-   * table.
-   */
-
-  for (tran_index = 1; tran_index < log_Gl.trantable.num_total_indices; tran_index++)
-    {
-      if ((tdes = LOG_FIND_TDES (tran_index)) != NULL && tdes->trid != NULL_TRANID
-	  && (tdes->state == TRAN_UNACTIVE_UNILATERALLY_ABORTED || tdes->state == TRAN_UNACTIVE_ABORTED)
-	  && LSA_ISNULL (&tdes->undo_nxlsa))
-	{
-	  (void) log_complete (thread_p, tdes, LOG_ABORT, LOG_DONT_NEED_NEWTRID, LOG_NEED_TO_WRITE_EOT_LOG);
-	  logtb_free_tran_index (thread_p, tran_index);
-	}
-    }
-  // *INDENT-OFF*
-  auto delete_func = [] (const LOG_TDES & tdes)
-    {
-      return LSA_ISNULL (&tdes.undo_nxlsa);
-    };
-  log_system_tdes::rv_delete_all_tdes_if (delete_func);
-  // *INDENT-ON*
-
-  /*
-   * GO BACKWARDS, undoing records
-   */
+  bool needs_sequential = false;
 
   // *INDENT-OFF*
-  auto max_undo_lsa_func = [&max_undo_lsa] (const log_tdes & tdes)
+  logtb_rv_read_only_map_undo_tdes (thread_p, [&needs_sequential] (const log_tdes & tdes)
     {
-      if (LSA_LT (&max_undo_lsa, &tdes.undo_nxlsa))
+      if (LSA_ISNULL (&tdes.undo_nxlsa))
         {
-          max_undo_lsa = tdes.undo_nxlsa;
+          return;
         }
-    };
+      if (logtb_is_system_worker_tranid (tdes.trid) || tdes.topops.last >= 0
+          || !LSA_ISNULL (&tdes.rcv.atomic_sysop_start_lsa) || !LSA_ISNULL (&tdes.rcv.sysop_start_postpone_lsa))
+        {
+          needs_sequential = true;
+        }
+    });
   // *INDENT-ON*
 
-  /* Find the largest LSA to undo */
-  logtb_rv_read_only_map_undo_tdes (thread_p, max_undo_lsa_func);
-  max_lsa = max_undo_lsa;
+  return needs_sequential;
+}
 
-  /* Print undo recovery information */
-  // *INDENT-OFF*
-  logtb_rv_read_only_map_undo_tdes (thread_p, [&cnt_trans_to_undo] (const LOG_TDES & tdes)
-    {
-      cnt_trans_to_undo++;
-    });
+// *INDENT-OFF*
+/*
+ * log_rv_undo_sync - completion of the parallel undo tasks
+ */
+struct log_rv_undo_sync
+{
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+  std::size_t m_done_count = 0;
 
-  logtb_rv_read_only_map_undo_tdes (thread_p, [&min_lsa] (const LOG_TDES & tdes) {
-    assert (!tdes.head_lsa.is_null());
-    if (min_lsa.is_null () || LSA_LT (&tdes.head_lsa, &min_lsa))
-      {
-        min_lsa = tdes.head_lsa;
-      }
-  });
-  // *INDENT-ON*
+  void notify_done ()
+  {
+    std::lock_guard<std::mutex> lock (m_mutex);
+    m_done_count++;
+    m_cond.notify_one ();
+  }
+};
 
-  total_page_cnt = max_lsa.is_null ()? 0 : log_cnt_pages_containing_lsa (&min_lsa, &max_lsa);
+/*
+ * log_rv_undo_task - undo all the log records of one transaction that was active at the time of the crash
+ */
+class log_rv_undo_task : public cubthread::entry_task
+{
+  public:
+    log_rv_undo_task (LOG_TDES *tdes, log_rv_undo_sync &sync)
+      : m_tdes (tdes)
+      , m_sync (sync)
+    {
+    }
 
-  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_RECOVERY_UNDO_STARTED, 2, total_page_cnt, cnt_trans_to_undo);
+    void execute (cubthread::entry &thread_ref) override;
+
+  private:
+    LOG_TDES *m_tdes;
+    log_rv_undo_sync &m_sync;
+};
+
+void
+log_rv_undo_task::execute (cubthread::entry &thread_ref)
+{
+  THREAD_ENTRY *thread_p = &thread_ref;
+  char log_pgbuf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT];
+  LOG_PAGE *log_pgptr = (LOG_PAGE *) PTR_ALIGN (log_pgbuf, MAX_ALIGNMENT);
+  LOG_ZIP *undo_unzip_ptr;
+  LOG_LSA log_lsa;
+  bool is_finished = false;
+
+  undo_unzip_ptr = log_zip_alloc (LOGAREA_SIZE);
+  if (undo_unzip_ptr == NULL)
+    {
+      logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_rv_undo_task");
+      m_sync.notify_done ();
+      return;
+    }
+
+  /* follow the transaction backwards; what is left are records of completed operations of the transaction */
+  while (!is_finished)
+    {
+      LSA_COPY (&log_lsa, &m_tdes->undo_nxlsa);
+      if (logpb_fetch_page (thread_p, &log_lsa, LOG_CS_FORCE_USE, log_pgptr) != NO_ERROR)
+	{
+	  logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_rv_undo_task");
+	  break;
+	}
+
+      is_finished = log_rv_undo_tdes_record (thread_p, m_tdes, &log_lsa, log_pgptr, undo_unzip_ptr);
+    }
+
+  log_zip_free (undo_unzip_ptr);
+  m_sync.notify_done ();
+}
+// *INDENT-ON*
+
+/*
+ * log_recovery_undo_parallel - undo the active worker transactions concurrently
+ *
+ * return: nothing
+ *
+ *   info_logging_interval_in_secs(in): interval of the progress messages, 0 for none
+ *   info_logging_start_time(in): start of the undo phase
+ *
+ * NOTE: Called once log_rv_undo_needs_sequential is false: the system
+ *              transactions are done and no worker transaction is inside a
+ *              system operation anymore. Each transaction is then rolled back
+ *              by a task of its own; the transactions cannot conflict on the
+ *              records they modified since they held the locks when the crash
+ *              happened.
+ *              Nothing is done unless recovery_undo_parallel_count is set and
+ *              there are at least two transactions to undo.
+ */
+static void
+log_recovery_undo_parallel (THREAD_ENTRY * thread_p, int info_logging_interval_in_secs,
+			    const TSC_TICKS * info_logging_start_time)
+{
+  int parallel_count = prm_get_integer_value (PRM_ID_RECOVERY_UNDO_PARALLEL_COUNT);
+  LOG_TDES *tdes;
+  int tran_index;
+  TSCTIMEVAL info_logging_elapsed_time;
+  // *INDENT-OFF*
+  std::vector<LOG_TDES *> undo_tdes_list;
+  log_rv_undo_sync sync;
+  cubthread::system_worker_entry_manager context_manager (TT_RECOVERY);
+  // *INDENT-ON*
+  cubthread::entry_workpool *workpool;
+
+  if (parallel_count < 2)
+    {
+      return;
+    }
+
+  for (tran_index = 1; tran_index < log_Gl.trantable.num_total_indices; tran_index++)
+    {
+      tdes = LOG_FIND_TDES (tran_index);
+      if (tdes != NULL && tdes->trid != NULL_TRANID
+	  && (tdes->state == TRAN_UNACTIVE_UNILATERALLY_ABORTED || tdes->state == TRAN_UNACTIVE_ABORTED)
+	  && !LSA_ISNULL (&tdes->undo_nxlsa))
+	{
+	  undo_tdes_list.push_back (tdes);
+	}
+    }
+
+  if (undo_tdes_list.size () < 2)
+    {
+      return;
+    }
+
+  workpool = cubthread::get_manager ()->create_worker_pool (MIN ((std::size_t) parallel_count, undo_tdes_list.size ()),
+							    undo_tdes_list.size (), "log_recovery_undo_thread_pool",
+							    &context_manager, 1, false);
+  if (workpool == NULL)
+    {
+      /* undo sequentially */
+      return;
+    }
+
+  // *INDENT-OFF*
+  for (LOG_TDES *undo_tdes : undo_tdes_list)
+    {
+      cubthread::get_manager ()->push_task (workpool, new log_rv_undo_task (undo_tdes, sync));
+    }
+
+  {
+    std::unique_lock<std::mutex> lock (sync.m_mutex);
+    auto all_done = [&sync, &undo_tdes_list] ()
+      {
+        return sync.m_done_count >= undo_tdes_list.size ();
+      };
+
+    if (info_logging_interval_in_secs <= 0)
+      {
+        sync.m_cond.wait (lock, all_done);
+      }
+    else
+      {
+        /* progress is counted in transactions, the records of the transactions are undone side by side */
+        while (!sync.m_cond.wait_for (lock, std::chrono::seconds (info_logging_interval_in_secs), all_done))
+          {
+            UINT64 done_tran_cnt = sync.m_done_count;
+            UINT64 total_tran_cnt = undo_tdes_list.size ();
+            double elapsed_time;
+
+            tsc_end_time_usec (&info_logging_elapsed_time, *info_logging_start_time);
+            elapsed_time = info_logging_elapsed_time.tv_sec + (info_logging_elapsed_time.tv_usec / 1000000.0);
+
+            er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_RECOVERY_PROGRESS, 6, "UNDO", done_tran_cnt,
+                    total_tran_cnt, double (done_tran_cnt) / total_tran_cnt * 100, elapsed_time,
+                    done_tran_cnt == 0 ? -1.0 : (elapsed_time / done_tran_cnt) * (total_tran_cnt - done_tran_cnt));
+          }
+      }
+  }
+  // *INDENT-ON*
+
+  cubthread::get_manager ()->destroy_worker_pool (workpool);
+}
+#endif /* SERVER_MODE */
+
+/*
+ * log_recovery_undo - SCAN BACKWARDS UNDOING DATA
+ *
+ * return: nothing
+ *
+ */
+static void
+log_recovery_undo (THREAD_ENTRY * thread_p)
+{
+  LOG_LSA max_undo_lsa = NULL_LSA;	/* LSA of log record to undo */
+  char log_pgbuf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT], *aligned_log_pgbuf;
+  LOG_PAGE *log_pgptr = NULL;	/* Log page pointer where LSA is located */
+  LOG_LSA log_lsa;
+  LOG_RECORD_HEADER *log_rec = NULL;	/* Pointer to log record */
+  LOG_TDES *tdes;		/* Transaction descriptor */
+  int tran_index;
+  LOG_ZIP *undo_unzip_ptr = NULL;
+  int cnt_trans_to_undo = 0;
+  LOG_LSA min_lsa = NULL_LSA;
+  LOG_LSA max_lsa = NULL_LSA;
+  volatile TRANID tran_id;
+  TSC_TICKS info_logging_start_time, info_logging_check_time;
+  TSCTIMEVAL info_logging_elapsed_time;
+  int info_logging_interval_in_secs = 0;
+  UINT64 total_page_cnt = 0, read_page_cnt = 0;
+#if defined (SERVER_MODE)
+  bool is_parallel_undo_pending = false;
+#endif
+
+  aligned_log_pgbuf = PTR_ALIGN (log_pgbuf, MAX_ALIGNMENT);
+
+  /*
+   * Remove from the list of transaction to abort, those that have finished
+   * when the crash happens, so it does not remain dangling in the transaction
+   * table.
+   */
+
+  for (tran_index = 1; tran_index < log_Gl.trantable.num_total_indices; tran_index++)
+    {
+      if ((tdes = LOG_FIND_TDES (tran_index)) != NULL && tdes->trid != NULL_TRANID
+	  && (tdes->state == TRAN_UNACTIVE_UNILATERALLY_ABORTED || tdes->state == TRAN_UNACTIVE_ABORTED)
+	  && LSA_ISNULL (&tdes->undo_nxlsa))
+	{
+	  (void) log_complete (thread_p, tdes, LOG_ABORT, LOG_DONT_NEED_NEWTRID, LOG_NEED_TO_WRITE_EOT_LOG);
+	  logtb_free_tran_index (thread_p, tran_index);
+	}
+    }
+  // *INDENT-OFF*
+  auto delete_func = [] (const LOG_TDES & tdes)
+    {
+      return LSA_ISNULL (&tdes.undo_nxlsa);
+    };
+  log_system_tdes::rv_delete_all_tdes_if (delete_func);
+  // *INDENT-ON*
+
+  /*
+   * GO BACKWARDS, undoing records
+   */
+
+  // *INDENT-OFF*
+  auto max_undo_lsa_func = [&max_undo_lsa] (const log_tdes & tdes)
+    {
+      if (LSA_LT (&max_undo_lsa, &tdes.undo_nxlsa))
+        {
+          max_undo_lsa = tdes.undo_nxlsa;
+        }
+    };
+  // *INDENT-ON*
+
+  /* Find the largest LSA to undo */
+  logtb_rv_read_only_map_undo_tdes (thread_p, max_undo_lsa_func);
+  max_lsa = max_undo_lsa;
+
+  /* Print undo recovery information */
+  // *INDENT-OFF*
+  logtb_rv_read_only_map_undo_tdes (thread_p, [&cnt_trans_to_undo] (const LOG_TDES & tdes)
+    {
+      cnt_trans_to_undo++;
+    });
+
+  logtb_rv_read_only_map_undo_tdes (thread_p, [&min_lsa] (const LOG_TDES & tdes) {
+    assert (!tdes.head_lsa.is_null());
+    if (min_lsa.is_null () || LSA_LT (&tdes.head_lsa, &min_lsa))
+      {
+        min_lsa = tdes.head_lsa;
+      }
+  });
+  // *INDENT-ON*
+
+  total_page_cnt = max_lsa.is_null ()? 0 : log_cnt_pages_containing_lsa (&min_lsa, &max_lsa);
+
+  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_RECOVERY_UNDO_STARTED, 2, total_page_cnt, cnt_trans_to_undo);
 
   log_pgptr = (LOG_PAGE *) aligned_log_pgbuf;
 
@@ -4528,8 +5036,26 @@ log_recovery_undo (THREAD_ENTRY * thread_p)
 
   LOG_CS_EXIT (thread_p);
 
+#if defined (SERVER_MODE)
+  is_parallel_undo_pending = prm_get_integer_value (PRM_ID_RECOVERY_UNDO_PARALLEL_COUNT) >= 2;
+#endif
+
   while (!LSA_ISNULL (&max_undo_lsa))
     {
+#if defined (SERVER_MODE)
+      if (is_parallel_undo_pending && !log_rv_undo_needs_sequential (thread_p))
+	{
+	  /* system transactions and unfinished system operations are undone; the rest may go in parallel */
+	  is_parallel_undo_pending = false;
+	  log_recovery_undo_parallel (thread_p, info_logging_interval_in_secs, &info_logging_start_time);
+
+	  /* what is left, if anything, is undone sequentially */
+	  max_undo_lsa = NULL_LSA;
+	  logtb_rv_read_only_map_undo_tdes (thread_p, max_undo_lsa_func);
+	  continue;
+	}
+#endif
+
       /* Fetch the page where the LSA record to undo is located */
       LSA_COPY (&log_lsa, &max_undo_lsa);
       if (logpb_fetch_page (thread_p, &log_lsa, LOG_CS_FORCE_USE, log_pgptr) != NO_ERROR)
@@ -4572,9 +5098,6 @@ log_recovery_undo (THREAD_ENTRY * thread_p)
 	  log_rec = LOG_GET_LOG_RECORD_HEADER (log_pgptr, &log_lsa);
 
 	  tran_id = log_rec->trid;
-	  log_rtype = log_rec->type;
-
-	  LSA_COPY (&prev_tranlsa, &log_rec->prev_tranlsa);
 
 	  if (logtb_is_system_worker_tranid (tran_id))
 	    {
@@ -4615,351 +5138,401 @@ log_recovery_undo (THREAD_ENTRY * thread_p)
 
 	  if (tran_index != NULL_TRAN_INDEX && tdes != NULL)
 	    {
-	      LSA_COPY (&tdes->undo_nxlsa, &prev_tranlsa);
+	      (void) log_rv_undo_tdes_record (thread_p, tdes, &log_lsa, log_pgptr, undo_unzip_ptr);
+	    }
 
-	      switch (log_rtype)
-		{
-		case LOG_MVCC_UNDOREDO_DATA:
-		case LOG_MVCC_DIFF_UNDOREDO_DATA:
-		case LOG_UNDOREDO_DATA:
-		case LOG_DIFF_UNDOREDO_DATA:
-		  LSA_COPY (&rcv_lsa, &log_lsa);
-		  /*
-		   * The transaction was active at the time of the crash. The
-		   * transaction is unilaterally aborted by the system
-		   */
+	  /* Find the next log record to undo */
+	  max_undo_lsa = NULL_LSA;
+	  logtb_rv_read_only_map_undo_tdes (thread_p, max_undo_lsa_func);
+	}
+    }
 
-		  if (log_rtype == LOG_MVCC_UNDOREDO_DATA || log_rtype == LOG_MVCC_DIFF_UNDOREDO_DATA)
-		    {
-		      is_mvcc_op = true;
-		    }
-		  else
-		    {
-		      is_mvcc_op = false;
-		    }
+  log_zip_free (undo_unzip_ptr);
 
-		  /* Get the DATA HEADER */
-		  LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), &log_lsa, log_pgptr);
+  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_RECOVERY_PHASE_FINISHING_UP, 1, "UNDO");
 
-		  if (is_mvcc_op)
-		    {
-		      data_header_size = sizeof (LOG_REC_MVCC_UNDOREDO);
-		      LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, data_header_size, &log_lsa, log_pgptr);
-		      mvcc_undoredo = (LOG_REC_MVCC_UNDOREDO *) ((char *) log_pgptr->area + log_lsa.offset);
+  /* Flush all dirty pages */
 
-		      /* Get undoredo info */
-		      undoredo = &mvcc_undoredo->undoredo;
+  LOG_CS_ENTER (thread_p);
 
-		      /* Save transaction MVCCID to recovery */
-		      rcv.mvcc_id = mvcc_undoredo->mvccid;
-		    }
-		  else
-		    {
-		      data_header_size = sizeof (LOG_REC_UNDOREDO);
-		      LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, data_header_size, &log_lsa, log_pgptr);
-		      undoredo = (LOG_REC_UNDOREDO *) ((char *) log_pgptr->area + log_lsa.offset);
+  logpb_flush_pages_direct (thread_p);
 
-		      rcv.mvcc_id = MVCCID_NULL;
-		    }
+  logpb_flush_header (thread_p);
+  log_recovery_flush_data_pages (thread_p);
+
+  return;
+}
+
+/*
+ * log_rv_undo_tdes_record - undo a log record of a transaction that was active at the time of the crash
+ *
+ * return: true if the transaction has nothing more to undo
+ *
+ *   tdes(in/out): Transaction descriptor; its undo_nxlsa is moved to the
+ *              record to undo next
+ *   log_lsa(in/out): Log address of the record (Set as a side effect to
+ *              the address where the record data ends)
+ *   log_pgptr(in/out): Log page where the record is located (Set as a side
+ *              effect to the page where the record data ends)
+ *   undo_unzip_ptr(in): Area used to unzip undo data
+ *
+ * NOTE: The transaction is completed and its index freed once its first
+ *              log record has been undone.
+ */
+static bool
+log_rv_undo_tdes_record (THREAD_ENTRY * thread_p, LOG_TDES * tdes, LOG_LSA * log_lsa, LOG_PAGE * log_pgptr,
+			 LOG_ZIP * undo_unzip_ptr)
+{
+  LOG_RECORD_HEADER *log_rec = NULL;	/* Pointer to log record */
+  LOG_REC_UNDOREDO *undoredo = NULL;	/* Undo_redo log record */
+  LOG_REC_UNDO *undo = NULL;	/* Undo log record */
+  LOG_REC_MVCC_UNDOREDO *mvcc_undoredo = NULL;	/* MVCC op Undo_redo log record */
+  LOG_REC_MVCC_UNDO *mvcc_undo = NULL;	/* MVCC op Undo log record */
+  LOG_REC_COMPENSATE *compensate;	/* Compensating log record */
+  LOG_REC_SYSOP_END *sysop_end;	/* Result of top system op */
+  LOG_RCVINDEX rcvindex;	/* Recovery index function */
+  LOG_RCV rcv;			/* Recovery structure */
+  VPID rcv_vpid;		/* VPID of data to recover */
+  LOG_LSA rcv_lsa;		/* Address of redo log record */
+  LOG_LSA prev_tranlsa;		/* prev LSA of transaction */
+  int tran_index = tdes->tran_index;
+  int data_header_size = 0;
+  bool is_mvcc_op;
+  TRANID tran_id;
+  LOG_RECTYPE log_rtype;
+
+  log_rec = LOG_GET_LOG_RECORD_HEADER (log_pgptr, log_lsa);
+
+  tran_id = log_rec->trid;
+  log_rtype = log_rec->type;
+
+  LSA_COPY (&prev_tranlsa, &log_rec->prev_tranlsa);
+
+  LSA_COPY (&tdes->undo_nxlsa, &prev_tranlsa);
+
+  switch (log_rtype)
+    {
+    case LOG_MVCC_UNDOREDO_DATA:
+    case LOG_MVCC_DIFF_UNDOREDO_DATA:
+    case LOG_UNDOREDO_DATA:
+    case LOG_DIFF_UNDOREDO_DATA:
+      LSA_COPY (&rcv_lsa, log_lsa);
+      /*
+       * The transaction was active at the time of the crash. The
+       * transaction is unilaterally aborted by the system
+       */
+
+      if (log_rtype == LOG_MVCC_UNDOREDO_DATA || log_rtype == LOG_MVCC_DIFF_UNDOREDO_DATA)
+	{
+	  is_mvcc_op = true;
+	}
+      else
+	{
+	  is_mvcc_op = false;
+	}
+
+      /* Get the DATA HEADER */
+      LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), log_lsa, log_pgptr);
+
+      if (is_mvcc_op)
+	{
+	  data_header_size = sizeof (LOG_REC_MVCC_UNDOREDO);
+	  LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, data_header_size, log_lsa, log_pgptr);
+	  mvcc_undoredo = (LOG_REC_MVCC_UNDOREDO *) ((char *) log_pgptr->area + log_lsa->offset);
+
+	  /* Get undoredo info */
+	  undoredo = &mvcc_undoredo->undoredo;
+
+	  /* Save transaction MVCCID to recovery */
+	  rcv.mvcc_id = mvcc_undoredo->mvccid;
+	}
+      else
+	{
+	  data_header_size = sizeof (LOG_REC_UNDOREDO);
+	  LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, data_header_size, log_lsa, log_pgptr);
+	  undoredo = (LOG_REC_UNDOREDO *) ((char *) log_pgptr->area + log_lsa->offset);
+
+	  rcv.mvcc_id = MVCCID_NULL;
+	}
 
-		  rcvindex = undoredo->data.rcvindex;
-		  rcv.length = undoredo->ulength;
-		  rcv.offset = undoredo->data.offset;
-		  rcv_vpid.volid = undoredo->data.volid;
-		  rcv_vpid.pageid = undoredo->data.pageid;
+      rcvindex = undoredo->data.rcvindex;
+      rcv.length = undoredo->ulength;
+      rcv.offset = undoredo->data.offset;
+      rcv_vpid.volid = undoredo->data.volid;
+      rcv_vpid.pageid = undoredo->data.pageid;
 
-		  LOG_READ_ADD_ALIGN (thread_p, data_header_size, &log_lsa, log_pgptr);
+      LOG_READ_ADD_ALIGN (thread_p, data_header_size, log_lsa, log_pgptr);
 
 #if !defined(NDEBUG)
-		  if (prm_get_bool_value (PRM_ID_LOG_TRACE_DEBUG))
-		    {
-		      fprintf (stdout,
-			       "TRACE UNDOING[1]: LSA = %lld|%d, Rv_index = %s,\n"
-			       "      volid = %d, pageid = %d, offset = %d,\n", (long long int) rcv_lsa.pageid,
-			       (int) rcv_lsa.offset, rv_rcvindex_string (rcvindex), rcv_vpid.volid, rcv_vpid.pageid,
-			       rcv.offset);
-		      fflush (stdout);
-		    }
+      if (prm_get_bool_value (PRM_ID_LOG_TRACE_DEBUG))
+	{
+	  fprintf (stdout,
+		   "TRACE UNDOING[1]: LSA = %lld|%d, Rv_index = %s,\n"
+		   "      volid = %d, pageid = %d, offset = %d,\n", (long long int) rcv_lsa.pageid,
+		   (int) rcv_lsa.offset, rv_rcvindex_string (rcvindex), rcv_vpid.volid, rcv_vpid.pageid,
+		   rcv.offset);
+	  fflush (stdout);
+	}
 #endif /* !NDEBUG */
 
-		  log_rv_undo_record (thread_p, &log_lsa, log_pgptr, rcvindex, &rcv_vpid, &rcv, &rcv_lsa, tdes,
-				      undo_unzip_ptr);
-		  break;
+      log_rv_undo_record (thread_p, log_lsa, log_pgptr, rcvindex, &rcv_vpid, &rcv, &rcv_lsa, tdes,
+			  undo_unzip_ptr);
+      break;
 
-		case LOG_MVCC_UNDO_DATA:
-		case LOG_UNDO_DATA:
-		  /* Does the record belong to a MVCC op? */
-		  is_mvcc_op = log_rtype == LOG_MVCC_UNDO_DATA;
+    case LOG_MVCC_UNDO_DATA:
+    case LOG_UNDO_DATA:
+      /* Does the record belong to a MVCC op? */
+      is_mvcc_op = log_rtype == LOG_MVCC_UNDO_DATA;
 
-		  LSA_COPY (&rcv_lsa, &log_lsa);
-		  /*
-		   * The transaction was active at the time of the crash. The
-		   * transaction is unilaterally aborted by the system
-		   */
+      LSA_COPY (&rcv_lsa, log_lsa);
+      /*
+       * The transaction was active at the time of the crash. The
+       * transaction is unilaterally aborted by the system
+       */
 
-		  /* Get the DATA HEADER */
-		  LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), &log_lsa, log_pgptr);
+      /* Get the DATA HEADER */
+      LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), log_lsa, log_pgptr);
 
-		  if (is_mvcc_op)
-		    {
-		      data_header_size = sizeof (LOG_REC_MVCC_UNDO);
-		      LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, data_header_size, &log_lsa, log_pgptr);
-		      mvcc_undo = (LOG_REC_MVCC_UNDO *) ((char *) log_pgptr->area + log_lsa.offset);
+      if (is_mvcc_op)
+	{
+	  data_header_size = sizeof (LOG_REC_MVCC_UNDO);
+	  LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, data_header_size, log_lsa, log_pgptr);
+	  mvcc_undo = (LOG_REC_MVCC_UNDO *) ((char *) log_pgptr->area + log_lsa->offset);
 
-		      /* Get undo info */
-		      undo = &mvcc_undo->undo;
+	  /* Get undo info */
+	  undo = &mvcc_undo->undo;
 
-		      /* Save transaction MVCCID to recovery */
-		      rcv.mvcc_id = mvcc_undo->mvccid;
-		    }
-		  else
-		    {
-		      data_header_size = sizeof (LOG_REC_UNDO);
-		      LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, data_header_size, &log_lsa, log_pgptr);
-		      undo = (LOG_REC_UNDO *) ((char *) log_pgptr->area + log_lsa.offset);
+	  /* Save transaction MVCCID to recovery */
+	  rcv.mvcc_id = mvcc_undo->mvccid;
+	}
+      else
+	{
+	  data_header_size = sizeof (LOG_REC_UNDO);
+	  LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, data_header_size, log_lsa, log_pgptr);
+	  undo = (LOG_REC_UNDO *) ((char *) log_pgptr->area + log_lsa->offset);
 
-		      rcv.mvcc_id = MVCCID_NULL;
-		    }
+	  rcv.mvcc_id = MVCCID_NULL;
+	}
 
-		  rcvindex = undo->data.rcvindex;
-		  rcv.length = undo->length;
-		  rcv.offset = undo->data.offset;
-		  rcv_vpid.volid = undo->data.volid;
-		  rcv_vpid.pageid = undo->data.pageid;
+      rcvindex = undo->data.rcvindex;
+      rcv.length = undo->length;
+      rcv.offset = undo->data.offset;
+      rcv_vpid.volid = undo->data.volid;
+      rcv_vpid.pageid = undo->data.pageid;
 
-		  LOG_READ_ADD_ALIGN (thread_p, data_header_size, &log_lsa, log_pgptr);
+      LOG_READ_ADD_ALIGN (thread_p, data_header_size, log_lsa, log_pgptr);
 
 #if !defined(NDEBUG)
-		  if (prm_get_bool_value (PRM_ID_LOG_TRACE_DEBUG))
-		    {
-		      fprintf (stdout,
-			       "TRACE UNDOING[2]: LSA = %lld|%d, Rv_index = %s,\n"
-			       "      volid = %d, pageid = %d, offset = %hd,\n", LSA_AS_ARGS (&rcv_lsa),
-			       rv_rcvindex_string (rcvindex), rcv_vpid.volid, rcv_vpid.pageid, rcv.offset);
-		      fflush (stdout);
-		    }
+      if (prm_get_bool_value (PRM_ID_LOG_TRACE_DEBUG))
+	{
+	  fprintf (stdout,
+		   "TRACE UNDOING[2]: LSA = %lld|%d, Rv_index = %s,\n"
+		   "      volid = %d, pageid = %d, offset = %hd,\n", LSA_AS_ARGS (&rcv_lsa),
+		   rv_rcvindex_string (rcvindex), rcv_vpid.volid, rcv_vpid.pageid, rcv.offset);
+	  fflush (stdout);
+	}
 #endif /* !NDEBUG */
-		  log_rv_undo_record (thread_p, &log_lsa, log_pgptr, rcvindex, &rcv_vpid, &rcv, &rcv_lsa, tdes,
-				      undo_unzip_ptr);
-		  break;
+      log_rv_undo_record (thread_p, log_lsa, log_pgptr, rcvindex, &rcv_vpid, &rcv, &rcv_lsa, tdes,
+			  undo_unzip_ptr);
+      break;
 
-		case LOG_REDO_DATA:
-		case LOG_MVCC_REDO_DATA:
-		case LOG_DBEXTERN_REDO_DATA:
-		case LOG_DUMMY_HEAD_POSTPONE:
-		case LOG_POSTPONE:
-		case LOG_SAVEPOINT:
-		case LOG_REPLICATION_DATA:
-		case LOG_REPLICATION_STATEMENT:
-		case LOG_DUMMY_HA_SERVER_STATE:
-		case LOG_DUMMY_OVF_RECORD:
-		case LOG_DUMMY_GENERIC:
-		case LOG_SUPPLEMENTAL_INFO:
-		case LOG_SYSOP_ATOMIC_START:
-		  /* Not for UNDO ... */
-		  /* Break switch to go to previous record */
-		  break;
+    case LOG_REDO_DATA:
+    case LOG_MVCC_REDO_DATA:
+    case LOG_DBEXTERN_REDO_DATA:
+    case LOG_DUMMY_HEAD_POSTPONE:
+    case LOG_POSTPONE:
+    case LOG_SAVEPOINT:
+    case LOG_REPLICATION_DATA:
+    case LOG_REPLICATION_STATEMENT:
+    case LOG_DUMMY_HA_SERVER_STATE:
+    case LOG_DUMMY_OVF_RECORD:
+    case LOG_DUMMY_GENERIC:
+    case LOG_SUPPLEMENTAL_INFO:
+    case LOG_SYSOP_ATOMIC_START:
+      /* Not for UNDO ... */
+      /* Break switch to go to previous record */
+      break;
 
-		case LOG_COMPENSATE:
-		  /* Only for REDO .. Go to next undo record Need to read the compensating record to set the next undo
-		   * address. */
-
-		  /* Get the DATA HEADER */
-		  LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), &log_lsa, log_pgptr);
-		  LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, sizeof (LOG_REC_COMPENSATE), &log_lsa, log_pgptr);
-		  compensate = (LOG_REC_COMPENSATE *) ((char *) log_pgptr->area + log_lsa.offset);
-		  LSA_COPY (&prev_tranlsa, &compensate->undo_nxlsa);
-		  break;
+    case LOG_COMPENSATE:
+      /* Only for REDO .. Go to next undo record Need to read the compensating record to set the next undo
+       * address. */
 
-		case LOG_SYSOP_END:
-		  /*
-		   * We found a system top operation that should be skipped from
-		   * rollback
-		   */
+      /* Get the DATA HEADER */
+      LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), log_lsa, log_pgptr);
+      LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, sizeof (LOG_REC_COMPENSATE), log_lsa, log_pgptr);
+      compensate = (LOG_REC_COMPENSATE *) ((char *) log_pgptr->area + log_lsa->offset);
+      LSA_COPY (&prev_tranlsa, &compensate->undo_nxlsa);
+      break;
 
-		  /* Read the DATA HEADER */
-		  LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), &log_lsa, log_pgptr);
-		  LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, sizeof (LOG_REC_SYSOP_END), &log_lsa, log_pgptr);
-		  sysop_end = ((LOG_REC_SYSOP_END *) ((char *) log_pgptr->area + log_lsa.offset));
+    case LOG_SYSOP_END:
+      /*
+       * We found a system top operation that should be skipped from
+       * rollback
+       */
 
-		  if (sysop_end->type == LOG_SYSOP_END_LOGICAL_UNDO)
-		    {
-		      /* execute undo */
-		      rcvindex = sysop_end->undo.data.rcvindex;
-		      rcv.length = sysop_end->undo.length;
-		      rcv.offset = sysop_end->undo.data.offset;
-		      rcv_vpid.volid = sysop_end->undo.data.volid;
-		      rcv_vpid.pageid = sysop_end->undo.data.pageid;
-		      rcv.mvcc_id = MVCCID_NULL;
-
-		      /* will jump to parent LSA. save it now before advancing to undo data */
-		      LSA_COPY (&prev_tranlsa, &sysop_end->lastparent_lsa);
-		      LSA_COPY (&tdes->undo_nxlsa, &sysop_end->lastparent_lsa);
-
-		      LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_REC_SYSOP_END), &log_lsa, log_pgptr);
-		      log_rv_undo_record (thread_p, &log_lsa, log_pgptr, rcvindex, &rcv_vpid, &rcv, &rcv_lsa, tdes,
-					  undo_unzip_ptr);
-		    }
-		  else if (sysop_end->type == LOG_SYSOP_END_LOGICAL_MVCC_UNDO)
-		    {
-		      /* execute undo */
-		      rcvindex = sysop_end->mvcc_undo.undo.data.rcvindex;
-		      rcv.length = sysop_end->mvcc_undo.undo.length;
-		      rcv.offset = sysop_end->mvcc_undo.undo.data.offset;
-		      rcv_vpid.volid = sysop_end->mvcc_undo.undo.data.volid;
-		      rcv_vpid.pageid = sysop_end->mvcc_undo.undo.data.pageid;
-		      rcv.mvcc_id = sysop_end->mvcc_undo.mvccid;
-
-		      /* will jump to parent LSA. save it now before advancing to undo data */
-		      LSA_COPY (&prev_tranlsa, &sysop_end->lastparent_lsa);
-		      LSA_COPY (&tdes->undo_nxlsa, &sysop_end->lastparent_lsa);
-		      LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_REC_SYSOP_END), &log_lsa, log_pgptr);
-		      log_rv_undo_record (thread_p, &log_lsa, log_pgptr, rcvindex, &rcv_vpid, &rcv, &rcv_lsa, tdes,
-					  undo_unzip_ptr);
-		    }
-		  else if (sysop_end->type == LOG_SYSOP_END_LOGICAL_COMPENSATE)
-		    {
-		      /* compensate */
-		      LSA_COPY (&prev_tranlsa, &sysop_end->compensate_lsa);
-		    }
-		  else
-		    {
-		      /* should not find run postpones on undo recovery */
-		      assert (sysop_end->type != LOG_SYSOP_END_LOGICAL_RUN_POSTPONE);
+      /* Read the DATA HEADER */
+      LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), log_lsa, log_pgptr);
+      LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, sizeof (LOG_REC_SYSOP_END), log_lsa, log_pgptr);
+      sysop_end = ((LOG_REC_SYSOP_END *) ((char *) log_pgptr->area + log_lsa->offset));
 
-		      /* jump to parent LSA */
-		      LSA_COPY (&prev_tranlsa, &sysop_end->lastparent_lsa);
-		    }
-		  break;
+      if (sysop_end->type == LOG_SYSOP_END_LOGICAL_UNDO)
+	{
+	  /* execute undo */
+	  rcvindex = sysop_end->undo.data.rcvindex;
+	  rcv.length = sysop_end->undo.length;
+	  rcv.offset = sysop_end->undo.data.offset;
+	  rcv_vpid.volid = sysop_end->undo.data.volid;
+	  rcv_vpid.pageid = sysop_end->undo.data.pageid;
+	  rcv.mvcc_id = MVCCID_NULL;
+
+	  /* will jump to parent LSA. save it now before advancing to undo data */
+	  LSA_COPY (&prev_tranlsa, &sysop_end->lastparent_lsa);
+	  LSA_COPY (&tdes->undo_nxlsa, &sysop_end->lastparent_lsa);
+
+	  LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_REC_SYSOP_END), log_lsa, log_pgptr);
+	  log_rv_undo_record (thread_p, log_lsa, log_pgptr, rcvindex, &rcv_vpid, &rcv, &rcv_lsa, tdes,
+			      undo_unzip_ptr);
+	}
+      else if (sysop_end->type == LOG_SYSOP_END_LOGICAL_MVCC_UNDO)
+	{
+	  /* execute undo */
+	  rcvindex = sysop_end->mvcc_undo.undo.data.rcvindex;
+	  rcv.length = sysop_end->mvcc_undo.undo.length;
+	  rcv.offset = sysop_end->mvcc_undo.undo.data.offset;
+	  rcv_vpid.volid = sysop_end->mvcc_undo.undo.data.volid;
+	  rcv_vpid.pageid = sysop_end->mvcc_undo.undo.data.pageid;
+	  rcv.mvcc_id = sysop_end->mvcc_undo.mvccid;
+
+	  /* will jump to parent LSA. save it now before advancing to undo data */
+	  LSA_COPY (&prev_tranlsa, &sysop_end->lastparent_lsa);
+	  LSA_COPY (&tdes->undo_nxlsa, &sysop_end->lastparent_lsa);
+	  LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_REC_SYSOP_END), log_lsa, log_pgptr);
+	  log_rv_undo_record (thread_p, log_lsa, log_pgptr, rcvindex, &rcv_vpid, &rcv, &rcv_lsa, tdes,
+			      undo_unzip_ptr);
+	}
+      else if (sysop_end->type == LOG_SYSOP_END_LOGICAL_COMPENSATE)
+	{
+	  /* compensate */
+	  LSA_COPY (&prev_tranlsa, &sysop_end->compensate_lsa);
+	}
+      else
+	{
+	  /* should not find run postpones on undo recovery */
+	  assert (sysop_end->type != LOG_SYSOP_END_LOGICAL_RUN_POSTPONE);
 
-		case LOG_RUN_POSTPONE:
-		case LOG_COMMIT_WITH_POSTPONE:
-		case LOG_COMMIT_WITH_POSTPONE_OBSOLETE:
-		case LOG_COMMIT:
-		case LOG_SYSOP_START_POSTPONE:
-		case LOG_ABORT:
-		case LOG_START_CHKPT:
-		case LOG_END_CHKPT:
-		case LOG_2PC_PREPARE:
-		case LOG_2PC_START:
-		case LOG_2PC_ABORT_DECISION:
-		case LOG_2PC_COMMIT_DECISION:
-		case LOG_2PC_ABORT_INFORM_PARTICPS:
-		case LOG_2PC_COMMIT_INFORM_PARTICPS:
-		case LOG_2PC_RECV_ACK:
-		case LOG_DUMMY_CRASH_RECOVERY:
-		case LOG_END_OF_LOG:
-		  /* This looks like a system error in the analysis phase */
+	  /* jump to parent LSA */
+	  LSA_COPY (&prev_tranlsa, &sysop_end->lastparent_lsa);
+	}
+      break;
+
+    case LOG_RUN_POSTPONE:
+    case LOG_COMMIT_WITH_POSTPONE:
+    case LOG_COMMIT_WITH_POSTPONE_OBSOLETE:
+    case LOG_COMMIT:
+    case LOG_SYSOP_START_POSTPONE:
+    case LOG_ABORT:
+    case LOG_START_CHKPT:
+    case LOG_END_CHKPT:
+    case LOG_2PC_PREPARE:
+    case LOG_2PC_START:
+    case LOG_2PC_ABORT_DECISION:
+    case LOG_2PC_COMMIT_DECISION:
+    case LOG_2PC_ABORT_INFORM_PARTICPS:
+    case LOG_2PC_COMMIT_INFORM_PARTICPS:
+    case LOG_2PC_RECV_ACK:
+    case LOG_DUMMY_CRASH_RECOVERY:
+    case LOG_END_OF_LOG:
+      /* This looks like a system error in the analysis phase */
 #if defined(CUBRID_DEBUG)
-		  er_log_debug (ARG_FILE_LINE,
-				"log_recovery_undo: SYSTEM ERROR for log located at %lld|%d,"
-				" Bad log_rectype = %d\n (%s).\n", (long long int) log_lsa.pageid, log_lsa.offset,
-				log_rtype, log_to_string (log_rtype));
+      er_log_debug (ARG_FILE_LINE,
+		    "log_recovery_undo: SYSTEM ERROR for log located at %lld|%d,"
+		    " Bad log_rectype = %d\n (%s).\n", (long long int) log_lsa->pageid, log_lsa->offset,
+		    log_rtype, log_to_string (log_rtype));
 #endif /* CUBRID_DEBUG */
-		  /* Remove the transaction from the recovery process */
-		  assert (false);
+      /* Remove the transaction from the recovery process */
+      assert (false);
 
-		  /* Clear MVCCID */
-		  tdes->mvccinfo.id = MVCCID_NULL;
+      /* Clear MVCCID */
+      tdes->mvccinfo.id = MVCCID_NULL;
 
-		  if (logtb_is_system_worker_tranid (tran_id))
-		    {
-		      // *INDENT-OFF*
-		      log_system_tdes::rv_delete_tdes (tran_id);
-		      // *INDENT-ON*
-		    }
-		  else
-		    {
-		      (void) log_complete (thread_p, tdes, LOG_ABORT, LOG_DONT_NEED_NEWTRID, LOG_NEED_TO_WRITE_EOT_LOG);
-		      logtb_free_tran_index (thread_p, tran_index);
-		    }
-		  tdes = NULL;
-		  break;
+      if (logtb_is_system_worker_tranid (tran_id))
+	{
+	  // *INDENT-OFF*
+	  log_system_tdes::rv_delete_tdes (tran_id);
+	  // *INDENT-ON*
+	}
+      else
+	{
+	  (void) log_complete (thread_p, tdes, LOG_ABORT, LOG_DONT_NEED_NEWTRID, LOG_NEED_TO_WRITE_EOT_LOG);
+	  logtb_free_tran_index (thread_p, tran_index);
+	}
+      tdes = NULL;
+      break;
 
-		case LOG_SMALLER_LOGREC_TYPE:
-		case LOG_LARGER_LOGREC_TYPE:
-		default:
+    case LOG_SMALLER_LOGREC_TYPE:
+    case LOG_LARGER_LOGREC_TYPE:
+    default:
 #if defined(CUBRID_DEBUG)
-		  er_log_debug (ARG_FILE_LINE,
-				"log_recovery_undo: Unknown record type = %d (%s)\n ... May be a system error",
-				log_rtype, log_to_string (log_rtype));
+      er_log_debug (ARG_FILE_LINE,
+		    "log_recovery_undo: Unknown record type = %d (%s)\n ... May be a system error",
+		    log_rtype, log_to_string (log_rtype));
 #endif /* CUBRID_DEBUG */
-		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_PAGE_CORRUPTED, 1, log_lsa.pageid);
-		  assert (false);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_PAGE_CORRUPTED, 1, log_lsa->pageid);
+      assert (false);
 
-		  /*
-		   * Remove the transaction from the recovery process
-		   */
+      /*
+       * Remove the transaction from the recovery process
+       */
 
-		  /* Clear MVCCID */
-		  tdes->mvccinfo.id = MVCCID_NULL;
+      /* Clear MVCCID */
+      tdes->mvccinfo.id = MVCCID_NULL;
 
-		  if (logtb_is_system_worker_tranid (tran_id))
-		    {
-		      // *INDENT-OFF*
-		      log_system_tdes::rv_delete_tdes (tran_id);
-		      // *INDENT-ON*
-		    }
-		  else
-		    {
-		      (void) log_complete (thread_p, tdes, LOG_ABORT, LOG_DONT_NEED_NEWTRID, LOG_NEED_TO_WRITE_EOT_LOG);
-		      logtb_free_tran_index (thread_p, tran_index);
-		    }
-		  tdes = NULL;
-		  break;
-		}
+      if (logtb_is_system_worker_tranid (tran_id))
+	{
+	  // *INDENT-OFF*
+	  log_system_tdes::rv_delete_tdes (tran_id);
+	  // *INDENT-ON*
+	}
+      else
+	{
+	  (void) log_complete (thread_p, tdes, LOG_ABORT, LOG_DONT_NEED_NEWTRID, LOG_NEED_TO_WRITE_EOT_LOG);
+	  logtb_free_tran_index (thread_p, tran_index);
+	}
+      tdes = NULL;
+      break;
+    }
 
-	      /* Just in case, it was changed */
-	      if (tdes != NULL)
-		{
-		  /* Is this the end of transaction? */
-		  if (LSA_ISNULL (&prev_tranlsa))
-		    {
-		      /* Clear MVCCID */
-		      tdes->mvccinfo.id = MVCCID_NULL;
+  /* Just in case, it was changed */
+  if (tdes != NULL)
+    {
+      /* Is this the end of transaction? */
+      if (LSA_ISNULL (&prev_tranlsa))
+	{
+	  /* Clear MVCCID */
+	  tdes->mvccinfo.id = MVCCID_NULL;
 
-		      if (logtb_is_system_worker_tranid (tran_id))
-			{
-			  // *INDENT-OFF*
-			  log_system_tdes::rv_delete_tdes (tran_id);
-			  // *INDENT-ON*
-			}
-		      else
-			{
-			  (void) log_complete (thread_p, tdes, LOG_ABORT, LOG_DONT_NEED_NEWTRID,
-					       LOG_NEED_TO_WRITE_EOT_LOG);
-			  logtb_free_tran_index (thread_p, tran_index);
-			  tdes = NULL;
-			}
-		    }
-		  else
-		    {
-		      /* Update transaction next undo LSA */
-		      LSA_COPY (&tdes->undo_nxlsa, &prev_tranlsa);
-		    }
-		}
+	  if (logtb_is_system_worker_tranid (tran_id))
+	    {
+	      // *INDENT-OFF*
+	      log_system_tdes::rv_delete_tdes (tran_id);
+	      // *INDENT-ON*
 	    }
-
-	  /* Find the next log record to undo */
-	  max_undo_lsa = NULL_LSA;
-	  logtb_rv_read_only_map_undo_tdes (thread_p, max_undo_lsa_func);
+	  else
+	    {
+	      (void) log_complete (thread_p, tdes, LOG_ABORT, LOG_DONT_NEED_NEWTRID,
+				   LOG_NEED_TO_WRITE_EOT_LOG);
+	      logtb_free_tran_index (thread_p, tran_index);
+	      tdes = NULL;
+	    }
+	}
+      else
+	{
+	  /* Update transaction next undo LSA */
+	  LSA_COPY (&tdes->undo_nxlsa, &prev_tranlsa);
 	}
     }
 
-  log_zip_free (undo_unzip_ptr);
-
-  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_RECOVERY_PHASE_FINISHING_UP, 1, "UNDO");
-
-  /* Flush all dirty pages */
-
-  LOG_CS_ENTER (thread_p);
-
-  logpb_flush_pages_direct (thread_p);
-
-  logpb_flush_header (thread_p);
-  (void) pgbuf_flush_all (thread_p, NULL_VOLID);
-
-  return;
+  return (tdes == NULL || LSA_ISNULL (&prev_tranlsa));
 }
 
 /*
@@ -1472,6 +1472,7 @@ logtb_free_tran_mvcc_info (LOG_TDES * tdes)
   MVCC_INFO *curr_mvcc_info = &tdes->mvccinfo;
 
   curr_mvcc_info->snapshot.m_active_mvccs.finalize ();
+  curr_mvcc_info->snapshot.m_shared_active_mvccs.reset ();
   curr_mvcc_info->sub_ids.clear ();
 }
 
@@ -4557,7 +4558,7 @@ logtb_complete_sub_mvcc (THREAD_ENTRY * thread_p, LOG_TDES * tdes)
 	  snapshot->highest_completed_mvccid = mvcc_sub_id;
 	  MVCCID_FORWARD (snapshot->highest_completed_mvccid);
 	}
-      snapshot->m_active_mvccs.set_inactive_mvccid (mvcc_sub_id);
+      snapshot->set_inactive_mvccid (mvcc_sub_id);
     }
 }
 
@@ -104,7 +104,7 @@ mvcc_is_id_in_snapshot (THREAD_ENTRY * thread_p, MVCCID mvcc_id, MVCC_SNAPSHOT *
       return true;
     }
 
-  return snapshot->m_active_mvccs.is_active (mvcc_id);
+  return snapshot->get_active_mvccs ().is_active (mvcc_id);
 }
 
 /*
@@ -656,6 +656,7 @@ mvcc_snapshot::mvcc_snapshot ()
   : lowest_active_mvccid (MVCCID_NULL)
   , highest_completed_mvccid (MVCCID_NULL)
   , m_active_mvccs ()
+  , m_shared_active_mvccs ()
   , snapshot_fnc (NULL)
   , valid (false)
 {
@@ -669,6 +670,7 @@ mvcc_snapshot::reset ()
   highest_completed_mvccid = MVCCID_NULL;
 
   m_active_mvccs.reset ();
+  m_shared_active_mvccs.reset ();
 
   valid = false;
 }
@@ -676,8 +678,17 @@ mvcc_snapshot::reset ()
 void
 mvcc_snapshot::copy_to (mvcc_snapshot & dest) const
 {
-  dest.m_active_mvccs.initialize ();
-  m_active_mvccs.copy_to (dest.m_active_mvccs, mvcc_active_tran::copy_safety::THREAD_SAFE);
+  if (m_shared_active_mvccs != NULL)
+    {
+      // the shared copy is immutable and can be shared with dest too
+      dest.m_shared_active_mvccs = m_shared_active_mvccs;
+    }
+  else
+    {
+      dest.m_active_mvccs.initialize ();
+      m_active_mvccs.copy_to (dest.m_active_mvccs, mvcc_active_tran::copy_safety::THREAD_SAFE);
+      dest.m_shared_active_mvccs.reset ();
+    }
 
   dest.lowest_active_mvccid = lowest_active_mvccid;
   dest.highest_completed_mvccid = highest_completed_mvccid;
@@ -685,6 +696,25 @@ mvcc_snapshot::copy_to (mvcc_snapshot & dest) const
   dest.valid = valid;
 }
 
+const mvcc_active_tran &
+mvcc_snapshot::get_active_mvccs () const
+{
+  return m_shared_active_mvccs != NULL ? *m_shared_active_mvccs : m_active_mvccs;
+}
+
+void
+mvcc_snapshot::set_inactive_mvccid (MVCCID mvccid)
+{
+  if (m_shared_active_mvccs != NULL)
+    {
+      // other snapshots may read the shared copy; change a private copy instead
+      m_active_mvccs.initialize ();
+      m_shared_active_mvccs->copy_to (m_active_mvccs, mvcc_active_tran::copy_safety::THREAD_SAFE);
+      m_shared_active_mvccs.reset ();
+    }
+  m_active_mvccs.set_inactive_mvccid (mvccid);
+}
+
 mvcc_info::mvcc_info ()
   : snapshot ()
   , id (MVCCID_NULL)
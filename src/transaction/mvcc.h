@@ -31,6 +31,7 @@
 #include "storage_common.h"
 #include "thread_compat.hpp"
 
+#include <memory>
 #include <vector>
 
 /* MVCC RECORD HEADER */
@@ -171,7 +172,10 @@ struct mvcc_snapshot
   MVCCID lowest_active_mvccid;	/* lowest active id */
   MVCCID highest_completed_mvccid;	/* highest mvccid in snapshot */
 
-  mvcc_active_tran m_active_mvccs;
+  mvcc_active_tran m_active_mvccs;	/* private copy, used when the snapshot was changed in place */
+  // *INDENT-OFF*
+  std::shared_ptr<const mvcc_active_tran> m_shared_active_mvccs;	/* copy shared by all snapshots of a status */
+  // *INDENT-ON*
 
   MVCC_SNAPSHOT_FUNC snapshot_fnc;	/* the snapshot function */
 
@@ -184,6 +188,9 @@ struct mvcc_snapshot
   mvcc_snapshot &operator= (const mvcc_snapshot& snapshot) = delete;
 
   void copy_to (mvcc_snapshot & other) const;
+
+  const mvcc_active_tran &get_active_mvccs () const;
+  void set_inactive_mvccid (MVCCID mvccid);
   // *INDENT-ON*
 };
 
@@ -118,6 +118,10 @@ mvcc_trans_status::mvcc_trans_status ()
   , m_last_completed_mvccid (MVCCID_NULL)
   , m_event_type (COMMIT)
   , m_version (0)
+  , m_shared_mutex ()
+  , m_shared_active_mvccs ()
+  , m_shared_version (0)
+  , m_shared_highest_completed_mvccid (MVCCID_NULL)
 {
 }
 
@@ -130,12 +134,50 @@ mvcc_trans_status::initialize ()
 {
   m_active_mvccs.initialize ();
   m_version = 0;
+  m_shared_active_mvccs.reset ();
 }
 
 void
 mvcc_trans_status::finalize ()
 {
   m_active_mvccs.finalize ();
+  m_shared_active_mvccs.reset ();
+}
+
+std::shared_ptr<const mvcc_active_tran>
+mvcc_trans_status::get_shared_active_mvccs (version_type version, MVCCID &highest_completed_mvccid)
+{
+  std::unique_lock<std::mutex> ulock (m_shared_mutex);
+
+  if (m_shared_active_mvccs == NULL || m_shared_version != version)
+    {
+      return NULL;
+    }
+  highest_completed_mvccid = m_shared_highest_completed_mvccid;
+  return m_shared_active_mvccs;
+}
+
+std::shared_ptr<const mvcc_active_tran>
+mvcc_trans_status::share_active_mvccs (version_type version,
+				       const std::shared_ptr<const mvcc_active_tran> &active_mvccs,
+				       MVCCID &highest_completed_mvccid)
+{
+  std::unique_lock<std::mutex> ulock (m_shared_mutex);
+
+  if (m_shared_active_mvccs != NULL && m_shared_version == version)
+    {
+      // another snapshot shared its copy first; use that one
+      highest_completed_mvccid = m_shared_highest_completed_mvccid;
+      return m_shared_active_mvccs;
+    }
+  if (m_version.load () == version)
+    {
+      // if the entry changes after the check, the new version does not match m_shared_version
+      m_shared_active_mvccs = active_mvccs;
+      m_shared_version = version;
+      m_shared_highest_completed_mvccid = highest_completed_mvccid;
+    }
+  return active_mvccs;
 }
 
 void
@@ -229,8 +271,13 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
   MVCCID crt_status_lowest_active;
   size_t index;
   mvcc_trans_status::version_type trans_status_version;
+  // *INDENT-OFF*
+  std::shared_ptr<const mvcc_active_tran> shared_active_mvccs;
+  std::shared_ptr<mvcc_active_tran> new_active_mvccs;
+  // *INDENT-ON*
 
   MVCCID highest_completed_mvccid;
+  mvcc_snapshot &snapshot = tdes.mvccinfo.snapshot;
 
   bool is_perf_tracking = perfmon_is_perf_tracking ();
   TSC_TICKS start_tick, end_tick;
@@ -245,9 +292,6 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
       tsc_getticks (&start_tick);
     }
 
-  // make sure snapshot has allocated data
-  tdes.mvccinfo.snapshot.m_active_mvccs.initialize ();
-
   tx_lowest_active = oldest_active_get (m_transaction_lowest_visible_mvccids[tdes.tran_index], tdes.tran_index,
 					oldest_active_event::BUILD_MVCC_INFO);
 
@@ -294,11 +338,24 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
       index = m_trans_status_history_position.load ();
       assert (index < HISTORY_MAX_SIZE);
 
-      const mvcc_trans_status &trans_status = m_trans_status_history[index];
+      mvcc_trans_status &trans_status = m_trans_status_history[index];
 
       trans_status_version = trans_status.m_version.load ();
-      trans_status.m_active_mvccs.copy_to (tdes.mvccinfo.snapshot.m_active_mvccs,
-					   mvcc_active_tran::copy_safety::THREAD_UNSAFE);
+
+      // all snapshots built from the same status version share one copy of its active MVCCIDs; only the first one
+      // pays for copying the bit area
+      shared_active_mvccs = trans_status.get_shared_active_mvccs (trans_status_version, highest_completed_mvccid);
+      if (shared_active_mvccs == NULL)
+	{
+	  if (new_active_mvccs == NULL)
+	    {
+	      // *INDENT-OFF*
+	      new_active_mvccs = std::make_shared<mvcc_active_tran> ();
+	      // *INDENT-ON*
+	      new_active_mvccs->initialize ();
+	    }
+	  trans_status.m_active_mvccs.copy_to (*new_active_mvccs, mvcc_active_tran::copy_safety::THREAD_UNSAFE);
+	}
 
       if (logtb_load_global_statistics_to_tran (thread_get_thread_entry_info())!= NO_ERROR)
 	{
@@ -311,28 +368,37 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
 	  // no version change; copying status was successful
 	  break;
 	}
-      else
+      else if (shared_active_mvccs == NULL)
 	{
 	  // a failed copy may break data validity; to make sure next copy is not affected, it is better to reset
 	  // bit area.
-	  tdes.mvccinfo.snapshot.m_active_mvccs.reset_active_transactions ();
+	  new_active_mvccs->reset_active_transactions ();
 	}
     }
 
-  // tdes.mvccinfo.snapshot.m_active_mvccs was not checked because it was not safe; now it is
-  tdes.mvccinfo.snapshot.m_active_mvccs.check_valid ();
+  if (shared_active_mvccs == NULL)
+    {
+      // new_active_mvccs was not checked because it was not safe; now it is
+      new_active_mvccs->check_valid ();
+
+      highest_completed_mvccid = new_active_mvccs->compute_highest_completed_mvccid ();
+      MVCCID_FORWARD (highest_completed_mvccid);
+
+      // from now on the copy is immutable
+      shared_active_mvccs = m_trans_status_history[index].share_active_mvccs (trans_status_version, new_active_mvccs,
+			    highest_completed_mvccid);
+    }
 
-  highest_completed_mvccid = tdes.mvccinfo.snapshot.m_active_mvccs.compute_highest_completed_mvccid ();
-  MVCCID_FORWARD (highest_completed_mvccid);
+  snapshot.m_shared_active_mvccs = shared_active_mvccs;
 
   /* update lowest active mvccid computed for the most recent snapshot */
   tdes.mvccinfo.recent_snapshot_lowest_active_mvccid = crt_status_lowest_active;
 
   /* update remaining snapshot data */
-  tdes.mvccinfo.snapshot.snapshot_fnc = mvcc_satisfies_snapshot;
-  tdes.mvccinfo.snapshot.lowest_active_mvccid = crt_status_lowest_active;
-  tdes.mvccinfo.snapshot.highest_completed_mvccid = highest_completed_mvccid;
-  tdes.mvccinfo.snapshot.valid = true;
+  snapshot.snapshot_fnc = mvcc_satisfies_snapshot;
+  snapshot.lowest_active_mvccid = crt_status_lowest_active;
+  snapshot.highest_completed_mvccid = highest_completed_mvccid;
+  snapshot.valid = true;
 
   if (is_perf_tracking)
     {
@@ -603,6 +669,8 @@ mvcctable::reset_start_mvccid ()
 
   assert (m_trans_status_history_position < HISTORY_MAX_SIZE);
   m_trans_status_history[m_trans_status_history_position].m_active_mvccs.reset_start_mvccid (log_Gl.hdr.mvcc_next_id);
+  // status changed in place; its shared copy must not be used anymore
+  m_trans_status_history[m_trans_status_history_position].m_version = ++m_current_trans_status.m_version;
 
   m_current_status_lowest_active_mvccid.store (log_Gl.hdr.mvcc_next_id);
 }
@@ -31,6 +31,7 @@
 #include "storage_common.h"
 
 #include <atomic>
+#include <memory>
 #include <mutex>
 
 // forward declarations
@@ -54,11 +55,23 @@ struct mvcc_trans_status
   event_type m_event_type;          // just for info
   std::atomic<version_type> m_version;
 
+  // immutable copy of m_active_mvccs shared by all snapshots built from this status; it belongs to m_shared_version
+  // and is ignored once the entry is reused for another version
+  std::mutex m_shared_mutex;
+  std::shared_ptr<const mvcc_active_tran> m_shared_active_mvccs;
+  version_type m_shared_version;
+  MVCCID m_shared_highest_completed_mvccid;
+
   mvcc_trans_status ();
   ~mvcc_trans_status ();
 
   void initialize ();
   void finalize ();
+
+  std::shared_ptr<const mvcc_active_tran> get_shared_active_mvccs (version_type version,
+      MVCCID &highest_completed_mvccid);
+  std::shared_ptr<const mvcc_active_tran> share_active_mvccs (version_type version,
+      const std::shared_ptr<const mvcc_active_tran> &active_mvccs, MVCCID &highest_completed_mvccid);
 };
 
 class mvcctable
@@ -20,10 +20,15 @@
  * test_loaddb.cpp - implementation for loaddb parse tests
  */
 
+#include <cstdio>
+#include <fstream>
+#include <iostream>
 #include <sstream>
 #include <thread>
+#include <vector>
 
 #include "language_support.h"
+#include "load_common.hpp"
 #include "load_driver.hpp"
 #include "test_loaddb.hpp"
 
@@ -88,4 +93,158 @@ namespace test_loaddb
 	threads[i].join ();
       }
   }
+
+  struct split_batch
+  {
+    cubload::class_id clsid;
+    std::string content;
+    int64_t line_offset;
+    int64_t rows;
+  };
+
+  static int
+  check_split (const char *test_name, const std::string &object_file_content, int batch_size,
+	       size_t buffer_size_limit, const std::vector<int64_t> &expected_class_lines,
+	       const std::vector<split_batch> &expected_batches)
+  {
+    const std::string object_file_name = "test_loaddb_split.txt";
+    std::vector<int64_t> class_lines;
+    std::vector<split_batch> batches;
+    int error_code;
+
+    std::ofstream object_file (object_file_name, std::ofstream::out | std::ofstream::binary);
+    object_file << object_file_content;
+    object_file.close ();
+
+    cubload::class_handler c_handler = [&class_lines] (const cubload::batch &batch, bool &is_ignored) -> int64_t
+    {
+      class_lines.push_back (batch.get_line_offset ());
+      is_ignored = false;
+      return NO_ERROR;
+    };
+    cubload::batch_handler b_handler = [&batches] (const cubload::batch &batch) -> int64_t
+    {
+      batches.push_back ({batch.get_class_id (), batch.get_content (), batch.get_line_offset (),
+			  batch.get_rows_number ()});
+      return NO_ERROR;
+    };
+
+    error_code = cubload::split (batch_size, object_file_name, c_handler, b_handler, buffer_size_limit);
+    std::remove (object_file_name.c_str ());
+
+    if (error_code != NO_ERROR)
+      {
+	std::cout << test_name << ": split failed with error " << error_code << std::endl;
+	return error_code;
+      }
+
+    if (class_lines != expected_class_lines)
+      {
+	std::cout << test_name << ": unexpected class lines" << std::endl;
+	return ER_FAILED;
+      }
+
+    if (batches.size () != expected_batches.size ())
+      {
+	std::cout << test_name << ": " << batches.size () << " batches instead of " << expected_batches.size ()
+		  << std::endl;
+	return ER_FAILED;
+      }
+
+    for (size_t i = 0; i < batches.size (); i++)
+      {
+	if (batches[i].clsid != expected_batches[i].clsid || batches[i].content != expected_batches[i].content
+	    || batches[i].line_offset != expected_batches[i].line_offset
+	    || batches[i].rows != expected_batches[i].rows)
+	  {
+	    std::cout << test_name << ": unexpected batch " << i << " (class " << batches[i].clsid << ", line "
+		      << batches[i].line_offset << ", " << batches[i].rows << " rows):" << std::endl
+		      << batches[i].content << std::endl;
+	    return ER_FAILED;
+	  }
+      }
+
+    return NO_ERROR;
+  }
+
+  int
+  test_split_plus_continuation ()
+  {
+    std::string s = "%class [foo] ([id] [name])\n"
+		    "1 'a'\n"
+		    "2 +\n" // instance line continues on the next line
+		    "'b'\n"
+		    "3 'c'\n";
+
+    return check_split ("test_split_plus_continuation", s, 100, 1024, { 0 },
+    {
+      { cubload::FIRST_CLASS_ID + 1, "1 'a'\n2 +\n'b'\n3 'c'\n", 1, 3 }
+    });
+  }
+
+  int
+  test_split_open_quote ()
+  {
+    std::string s = "%class [foo] ([id] [name])\n"
+		    "1 'first\n" // quoted string spans over multiple lines
+		    "second\n"
+		    "third'\n"
+		    "2 'd'\n";
+
+    return check_split ("test_split_open_quote", s, 100, 1024, { 0 },
+    {
+      { cubload::FIRST_CLASS_ID + 1, "1 'first\nsecond\nthird'\n2 'd'\n", 1, 2 }
+    });
+  }
+
+  int
+  test_split_batch_size ()
+  {
+    std::string s = "%class [foo] ([id])\n"
+		    "1\n"
+		    "2 +\n"
+		    "3\n"
+		    "4\n";
+
+    // the batch is full once the wrapped row is complete; the next batch starts after it
+    return check_split ("test_split_batch_size", s, 2, 1024, { 0 },
+    {
+      { cubload::FIRST_CLASS_ID + 1, "1\n2 +\n3\n", 1, 2 },
+      { cubload::FIRST_CLASS_ID + 1, "4\n", 4, 1 }
+    });
+  }
+
+  int
+  test_split_size_over ()
+  {
+    std::string s = "%class [foo] ([name])\n"
+		    "'aaaa'\n"
+		    "'bbbb' +\n"
+		    "'cccc'\n"
+		    "'dd'\n";
+
+    // a row that does not fit in the current batch starts the next one, from its first line
+    return check_split ("test_split_size_over", s, 100, 16, { 0 },
+    {
+      { cubload::FIRST_CLASS_ID + 1, "'aaaa'\n", 1, 1 },
+      { cubload::FIRST_CLASS_ID + 1, "'bbbb' +\n'cccc'\n", 2, 1 },
+      { cubload::FIRST_CLASS_ID + 1, "'dd'\n", 4, 1 }
+    });
+  }
+
+  int
+  test_split_class_after_pending_row ()
+  {
+    std::string s = "%class [foo] ([id])\n"
+		    "1 +\n" // not completed before the next class
+		    "%class [bar] ([id])\n"
+		    "2\n";
+
+    // the incomplete row is sent with the batch of its class, and the lexer reports it
+    return check_split ("test_split_class_after_pending_row", s, 100, 1024, { 0, 2 },
+    {
+      { cubload::FIRST_CLASS_ID + 1, "1 +\n", 1, 0 },
+      { cubload::FIRST_CLASS_ID + 2, "2\n", 3, 1 }
+    });
+  }
 } // namespace test_loaddb
@@ -27,6 +27,12 @@ namespace test_loaddb
 {
   void test_parse_with_multiple_threads ();
   void test_parse_reusing_driver ();
+
+  int test_split_plus_continuation ();
+  int test_split_open_quote ();
+  int test_split_batch_size ();
+  int test_split_size_over ();
+  int test_split_class_after_pending_row ();
 }; // namespace test_loaddb
 
 #endif //_TEST_LOADDB_PASRE_HPP_
@@ -18,11 +18,41 @@
 
 #include "test_loaddb.hpp"
 
+#include <iostream>
+
+template <typename Func, typename ... Args>
+int
+test_module (int &global_error, Func &&f, Args &&... args)
+{
+  std::cout << std::endl;
+  std::cout << "  start testing module ";
+
+  int err = f (std::forward <Args> (args)...);
+  if (err == 0)
+    {
+      std::cout << "  test completed successfully" << std::endl;
+    }
+  else
+    {
+      std::cout << "  test failed" << std::endl;
+      global_error = global_error == 0 ? err : global_error;
+    }
+  return err;
+}
+
 int
 main (int, char **)
 {
+  int global_error = 0;
+
   //test_loaddb::test_parse_with_multiple_threads ();
   //test_loaddb::test_parse_reusing_driver ();
 
-  return 0;
+  test_module (global_error, test_loaddb::test_split_plus_continuation);
+  test_module (global_error, test_loaddb::test_split_open_quote);
+  test_module (global_error, test_loaddb::test_split_batch_size);
+  test_module (global_error, test_loaddb::test_split_size_over);
+  test_module (global_error, test_loaddb::test_split_class_after_pending_row);
+
+  return global_error;
 }